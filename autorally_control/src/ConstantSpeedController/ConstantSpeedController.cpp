@@ -38,6 +38,8 @@
 
 #include "ConstantSpeedController.h"
 
+#include <autorally_core/Trace.h>
+
 #define PI 3.14159265
 #define DEGTORAD (PI/180)
 
@@ -108,6 +110,8 @@ void ConstantSpeedController::speedCallback(const std_msgs::Float64ConstPtr& msg
 
 void ConstantSpeedController::wheelSpeedsCallback(const autorally_msgs::wheelSpeedsConstPtr& msg)
 {
+  autorally_core::TraceSpan span("ConstantSpeedController::wheelSpeedsCallback",
+                                 autorally_core::Trace::id(msg->header.stamp));
   m_frontWheelsSpeed = 0.5*(msg->lfSpeed + msg->rfSpeed);
   //m_backWheelsSpeed = 0.2*m_backWheelsSpeed + 0.4*(msg->lbSpeed + msg->rbSpeed);
 
@@ -152,6 +156,7 @@ void ConstantSpeedController::wheelSpeedsCallback(const autorally_msgs::wheelSpe
     command->throttle = 0;
     
   }
+  span.setNextId(autorally_core::Trace::id(command->header.stamp));
   m_chassisCommandPub.publish(command);
 }
 
@@ -39,15 +39,30 @@
 #include <vector>
 #include "gpsWaypoint.h"
 
+#include <autorally_core/Trace.h>
+
+#include <pluginlib/class_list_macros.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_control, GpsWaypoint, autorally_control::GpsWaypoint, nodelet::Nodelet)
+
 namespace autorally_control
 {
 
   GpsWaypoint::GpsWaypoint() :
-    m_nh("~"), m_speed(0.0), m_useThetaGPS(true), m_prevTime(0.0)
+    m_speed(0.0), m_useThetaGPS(true), m_compensateLatency(false), m_prevTime(0.0)
+  {}
+
+  void GpsWaypoint::onInit()
   {
+    m_nh = getPrivateNodeHandle();
     m_nh.param("WaypointFile", m_filename, std::string("waypoints.txt"));
     m_nh.param("WaypointRadius", m_wpRadius, 1.5);
     m_nh.param("HeadingP", m_headingP, 2.0);
+    m_nh.param("CompensateLatency", m_compensateLatency, false);
+    if (m_compensateLatency)
+    {
+      m_predictor.init(m_nh, m_nh.resolveName("Odom"), "waypointFollower");
+    }
     
     m_speedSub = m_nh.subscribe("Speeds", 1, &GpsWaypoint::Speedcb, this);
     m_odomSub = m_nh.subscribe("Odom", 1, &GpsWaypoint::Odomcb, this);
@@ -86,14 +101,19 @@ namespace autorally_control
     dynamic_reconfigure::Server<gpsWaypoint_paramsConfig>::CallbackType cb;
 
     cb = boost::bind(&GpsWaypoint::ConfigCallback, this, _1, _2);
-    m_dynServer.setCallback(cb);
-    ros::Duration d = ros::Duration(1.0);
-    d.sleep();
-    PublishMarkers_track();
+    m_dynServer.reset(new dynamic_reconfigure::Server<gpsWaypoint_paramsConfig>(m_nh));
+    m_dynServer->setCallback(cb);
+    // Give subscribers time to connect before the track is published
+    m_trackTimer = m_nh.createTimer(ros::Duration(1.0), &GpsWaypoint::trackTimerCallback, this, true);
   }
 
   GpsWaypoint::~GpsWaypoint()
   {}
+
+  void GpsWaypoint::trackTimerCallback(const ros::TimerEvent& /*time*/)
+  {
+    PublishMarkers_track();
+  }
   
   void GpsWaypoint::Speedcb(autorally_msgs::wheelSpeeds speeds)
   {
@@ -104,6 +124,7 @@ namespace autorally_control
 
   void GpsWaypoint::Odomcb(nav_msgs::Odometry position)
   {
+    autorally_core::TraceSpan span("GpsWaypoint::Odomcb", autorally_core::Trace::id(position.header.stamp));
     double speed;
     double x, y, theta;
     m_lock.lock();
@@ -126,6 +147,20 @@ namespace autorally_control
     double thetaGPS = atan2(deltaY,deltaX);
     m_lock.unlock();
 
+    // Steer from where the vehicle will be when this command reaches the wheels
+    autorally_core::TrajectoryStore::State predicted;
+    if (m_compensateLatency && m_predictor.predict(ros::Time::now(), predicted))
+    {
+      x = predicted.pose.position.x;
+      y = predicted.pose.position.y;
+      tf::Quaternion predictedQuat(predicted.pose.orientation.x,
+                                   predicted.pose.orientation.y,
+                                   predicted.pose.orientation.z,
+                                   predicted.pose.orientation.w);
+      tf::Matrix3x3(predictedQuat).getRPY(roll, pitch, yaw);
+      thetaGPS = atan2(predicted.twist.linear.y, predicted.twist.linear.x);
+    }
+
     if (m_useThetaGPS)
       theta = thetaGPS;
     else
@@ -158,6 +193,7 @@ namespace autorally_control
 
     command.header.stamp = ros::Time::now();
     command.sender = "waypointFollower";
+    span.setNextId(autorally_core::Trace::id(command.header.stamp));
     m_chassisCommandPub.publish(command);
 
     //m_imMask.lines[0].end.x = 256 - (100 * cos((command.steering * PI / 2.0) + PI/2.0));
@@ -306,11 +342,3 @@ namespace autorally_control
     std::cout << "Got a config!!" << std::endl;
   }
 };
-
-int main (int argc, char** argv)
-{
-  ros::init(argc, argv, "GpsWaypoint");
-  //ros::NodeHandle n;
-  autorally_control::GpsWaypoint wpt;
-  ros::spin();
-}
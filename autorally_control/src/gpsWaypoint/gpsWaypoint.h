@@ -44,6 +44,7 @@
 
 #include <ros/ros.h>
 #include <ros/time.h>
+#include <nodelet/nodelet.h>
 #include <tf/transform_listener.h>
 #include <std_msgs/Float64.h>
 #include <sensor_msgs/Imu.h>
@@ -56,16 +57,19 @@
 
 #include <dynamic_reconfigure/server.h>
 #include <autorally_control/gpsWaypoint_paramsConfig.h>
+#include <autorally_core/StatePredictor.h>
 
 #define PI 3.14159265358979323846264338
 
 namespace autorally_control
 {
-  class GpsWaypoint
+  class GpsWaypoint : public nodelet::Nodelet
   {
   public:
     GpsWaypoint();
     ~GpsWaypoint();
+
+    virtual void onInit();
   private:
     ros::NodeHandle m_nh;
     ros::Subscriber m_speedSub;
@@ -74,6 +78,7 @@ namespace autorally_control
     ros::Publisher  m_chassisCommandPub;
     ros::Publisher vis_pub;
     ros::Timer m_paramTimer;
+    ros::Timer m_trackTimer; ///< One shot timer to publish the waypoint track after startup
 
 
     std::string m_filename;
@@ -86,10 +91,12 @@ namespace autorally_control
     double m_wpRadius;
     double m_headingP;
     bool m_useThetaGPS;
+    bool m_compensateLatency; ///< Steer from the state predicted at actuation time
+    autorally_core::StatePredictor m_predictor;
     double m_offsetX, m_offsetY;
     double m_prevTime;
 
-    dynamic_reconfigure::Server<gpsWaypoint_paramsConfig> m_dynServer;
+    boost::shared_ptr<dynamic_reconfigure::Server<gpsWaypoint_paramsConfig> > m_dynServer;
 
     tf::TransformListener m_tf;
 
@@ -107,6 +114,7 @@ namespace autorally_control
     double Clamp(double num, double min, double max);
     void PublishMarkers(double x, double y, double yaw, double xwp, double ywp);
     void PublishMarkers_track();
+    void trackTimerCallback(const ros::TimerEvent& time);
     void ConfigCallback(const gpsWaypoint_paramsConfig &config, uint32_t level);
 
 
@@ -28,123 +28,207 @@
  * @author Brian Goldfain <bgoldfai@gmail.com>
  * @date January 19, 2012
  * @copyright 2012 Georgia Institute of Technology
- * @brief Brief file description
- *        Brief description continued.
+ * @brief Use a joystick or gamepad connected to the the computer
+ * to control the throttle/brake and steering commands
  *
- * @details Detailed file description starts here.
+ * @details JoystickControl nodelet implementation
  ***********************************************/
 
+#include <math.h>
+#include <algorithm>
+
+#include <pluginlib/class_list_macros.h>
+
 #include "JoystickControl.h"
 
+#include <autorally_core/Trace.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_control, JoystickControl, autorally_control::JoystickControl, nodelet::Nodelet)
+
+namespace autorally_control
+{
+
 JoystickControl::JoystickControl():
+  motionEnabled_(false),
   throttleDamping_(0.0),
   steeringDamping_(0.0),
   throttleEnabled_(true),
-  steeringEnabled_(true)
-{
-  m_joySub = nh_.subscribe("joy", 1, &JoystickControl::joyCallback, this);
+  steeringEnabled_(true),
+  throttleAxis_(-1),
+  steeringAxis_(-1),
+  brakeAxis_(-1),
+  runstopToggleMask_(0),
+  throttleEnableMask_(0),
+  steeringEnableMask_(0),
+  prevButtons_(0)
+{}
 
-  commandPub_ = nh_.advertise
-                 <autorally_msgs::chassisCommand>
-                 ("joystick/chassisCommand", 1);
-  runstopPub_ = nh_.advertise
-                 <autorally_msgs::runstop>
-                 ("runstop", 1);
+JoystickControl::~JoystickControl()
+{}
 
-  runstop_.sender = "joystick";
-  runstop_.motionEnabled = false;
+void JoystickControl::onInit()
+{
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
 
-  if(!nh_.getParam("joystickController/throttleDamping", throttleDamping_) ||
-     !nh_.getParam("joystickController/steeringDamping", steeringDamping_) || 
-     !nh_.getParam("joystickController/throttleAxis", throttleAxis_) ||
-     !nh_.getParam("joystickController/steeringAxis", steeringAxis_) ||
-     !nh_.getParam("joystickController/throttleEnableButton", throttleEnableButton_) ||
-     !nh_.getParam("joystickController/steeringEnableButton", steeringEnableButton_) ||
-     !nh_.getParam("joystickController/brakeAxis", brakeAxis_) )
+  int throttleEnableButton = -1;
+  int steeringEnableButton = -1;
+  if(!nhPvt.getParam("throttleDamping", throttleDamping_) ||
+     !nhPvt.getParam("steeringDamping", steeringDamping_) ||
+     !nhPvt.getParam("throttleAxis", throttleAxis_) ||
+     !nhPvt.getParam("steeringAxis", steeringAxis_) ||
+     !nhPvt.getParam("throttleEnableButton", throttleEnableButton) ||
+     !nhPvt.getParam("steeringEnableButton", steeringEnableButton) ||
+     !nhPvt.getParam("brakeAxis", brakeAxis_) )
   {
-    ROS_ERROR_STREAM("Couldn't get joystick control parameters");
+    NODELET_ERROR_STREAM("Couldn't get joystick control parameters");
   }
+  throttleEnableMask_ = buttonMask(throttleEnableButton);
+  steeringEnableMask_ = buttonMask(steeringEnableButton);
 
   XmlRpc::XmlRpcValue v;
-  nh_.param("joystickController/runstopToggleButtons", v, v);
-  for(int i =0; i < v.size(); i++)
+  nhPvt.param("runstopToggleButtons", v, v);
+  if(v.getType() == XmlRpc::XmlRpcValue::TypeArray)
   {
-    runstopToggleButtons_.push_back(v[i]);
+    for(int i = 0; i < v.size(); i++)
+    {
+      runstopToggleMask_ |= buttonMask(static_cast<int>(v[i]));
+    }
+  } else
+  {
+    NODELET_ERROR_STREAM("Couldn't get joystick runstop toggle buttons");
   }
 
-  runstopTimer_ = nh_.createTimer(ros::Rate(5),
-                                   &JoystickControl::runstopCallback,
-                                   this);
+  chassisCommand_.reset(new autorally_msgs::chassisCommand);
+  runstop_.reset(new autorally_msgs::runstop);
+
+  commandPub_ = nh.advertise
+                 <autorally_msgs::chassisCommand>
+                 ("joystick/chassisCommand", 1);
+  runstopPub_ = nh.advertise
+                 <autorally_msgs::runstop>
+                 ("runstop", 1);
+
+  joySub_ = nh.subscribe("joy", 1, &JoystickControl::joyCallback, this);
 
+  runstopTimer_ = nh.createTimer(ros::Rate(5),
+                                 &JoystickControl::runstopCallback,
+                                 this);
 }
 
-JoystickControl::~JoystickControl()
-{}
+uint32_t JoystickControl::buttonMask(int button)
+{
+  if(button < 0 || button >= MAX_BUTTONS)
+  {
+    NODELET_ERROR_STREAM("Joystick button " << button << " is outside of [0, " << MAX_BUTTONS << ")");
+    return 0;
+  }
+  return 1u << button;
+}
 
 void JoystickControl::joyCallback(const sensor_msgs::Joy::ConstPtr& joy)
 {
+  autorally_core::TraceSpan span("JoystickControl::joyCallback");
   /* axes[0] is left/right of left sitck, axes[3] is up/down of right stick
    * I scale the range of values from the joystick [-1,1] to the range of
    * valid command values [-1.0, 1.0], and reverse the steering command so it
    * is drives as expected.
    */
+  if(throttleAxis_ < 0 || throttleAxis_ >= (int)joy->axes.size() ||
+     steeringAxis_ < 0 || steeringAxis_ >= (int)joy->axes.size())
+  {
+    NODELET_ERROR_STREAM_THROTTLE(5, "Joystick has " << joy->axes.size() <<
+                                  " axes, not enough for the configured throttle and steering axes");
+    return;
+  }
 
-  //toggle runstop if a runstop toggle button changed from 0 to 1  
-  for(auto vecIt : runstopToggleButtons_)
+  uint32_t buttons = 0;
+  size_t numButtons = std::min(joy->buttons.size(), (size_t)MAX_BUTTONS);
+  for(size_t i = 0; i < numButtons; ++i)
   {
-    if(joy->buttons[vecIt] == 1 && prevJoy_.buttons[vecIt] == 0)
+    if(joy->buttons[i])
     {
-      runstop_.motionEnabled = !runstop_.motionEnabled;
+      buttons |= 1u << i;
     }
   }
+  //buttons that changed from 0 to 1 since the last message
+  uint32_t pressed = buttons & ~prevButtons_;
+  prevButtons_ = buttons;
 
-  //can enable/disable throttle control with L2 on game pad, only toggle if button changed from 0 to 1
-  if(joy->buttons[throttleEnableButton_] == 1 && prevJoy_.buttons[throttleEnableButton_] == 0)
+  //toggle runstop if a runstop toggle button was pressed, and let everyone know right away
+  if(pressed & runstopToggleMask_)
+  {
+    boost::mutex::scoped_lock lock(runstopMutex_);
+    motionEnabled_ = !motionEnabled_;
+    publishRunstop();
+  }
+
+  //can enable/disable throttle control with L2 on game pad
+  if(pressed & throttleEnableMask_)
   {
     throttleEnabled_ = !throttleEnabled_;
   }
   
-  //can enable/disable steering control with R2 on game pad, only toggle if button changed from 0 to 1
-  if(joy->buttons[steeringEnableButton_] == 1 && prevJoy_.buttons[steeringEnableButton_] == 0)
+  //can enable/disable steering control with R2 on game pad
+  if(pressed & steeringEnableMask_)
   {
     steeringEnabled_ = !steeringEnabled_;
   }
+
+  //subscribers in the same process may still hold the last message
+  if(!chassisCommand_.unique())
+  {
+    chassisCommand_.reset(new autorally_msgs::chassisCommand);
+  }
   
   if(steeringEnabled_)
   {
-    chassis_command_.steering = -steeringDamping_*joy->axes[steeringAxis_];
+    chassisCommand_->steering = -steeringDamping_*joy->axes[steeringAxis_];
   } else
   {
-    chassis_command_.steering = -10.0;
+    chassisCommand_->steering = -10.0;
   }
   
   if(throttleEnabled_)
   {
-    
-    chassis_command_.throttle = throttleDamping_*joy->axes[throttleAxis_];
+    chassisCommand_->throttle = throttleDamping_*joy->axes[throttleAxis_];
 
-    if(chassis_command_.throttle < 0.0)
+    if(chassisCommand_->throttle < 0.0)
     {
-      chassis_command_.frontBrake = fabs(chassis_command_.throttle);
+      chassisCommand_->frontBrake = fabs(chassisCommand_->throttle);
     } else
     {
-      chassis_command_.frontBrake = 0.0;
+      chassisCommand_->frontBrake = 0.0;
     }
   } else
   {
-    chassis_command_.throttle = -10.0;
-    chassis_command_.frontBrake = -10.0;
+    chassisCommand_->throttle = -10.0;
+    chassisCommand_->frontBrake = -10.0;
   }
   
-  prevJoy_ = *joy;
-  chassis_command_.header.frame_id = "joystick";
-  chassis_command_.sender = "joystick";
-  chassis_command_.header.stamp = ros::Time::now();
-  commandPub_.publish(chassis_command_);
+  chassisCommand_->header.frame_id = "joystick";
+  chassisCommand_->sender = "joystick";
+  chassisCommand_->header.stamp = ros::Time::now();
+  span.setNextId(autorally_core::Trace::id(chassisCommand_->header.stamp));
+  commandPub_.publish(chassisCommand_);
 }
 
-void JoystickControl::runstopCallback(const ros::TimerEvent& time)
+void JoystickControl::runstopCallback(const ros::TimerEvent& /*time*/)
 {
-  runstop_.header.stamp = ros::Time::now();
+  boost::mutex::scoped_lock lock(runstopMutex_);
+  publishRunstop();
+}
+
+void JoystickControl::publishRunstop()
+{
+  if(!runstop_.unique())
+  {
+    runstop_.reset(new autorally_msgs::runstop);
+  }
+  runstop_->sender = "joystick";
+  runstop_->motionEnabled = motionEnabled_;
+  runstop_->header.stamp = ros::Time::now();
   runstopPub_.publish(runstop_);
 }
+
+}
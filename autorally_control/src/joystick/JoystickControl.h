@@ -36,17 +36,25 @@
 #ifndef JOYSTICK_CONTROL_H_
 #define JOYSTICK_CONTROL_H_
 
-//#include "autorally_msgs/servoControllerMSG.h"
+#include <stdint.h>
+#include <vector>
+
+#include <boost/thread.hpp>
+
 #include <ros/ros.h>
 #include <ros/time.h>
+#include <nodelet/nodelet.h>
 #include <sensor_msgs/Joy.h>
 #include <autorally_msgs/chassisCommand.h>
 #include <autorally_msgs/runstop.h>
 
+namespace autorally_control
+{
+
 /**
  *  @class JoystickControl JoystickControl.h "joystick/JoystickControl.h"
  *  @brief Use a joystick or gamepad connected to the computer to send out
- *  ServoControllerCommand messages
+ *  chassisCommand and runstop messages
  *
  *  The default configuration is for a gamepad with two joysticks. The left
  *  stick controlls the steering and the right stick controls the trottle.
@@ -54,56 +62,77 @@
  *  running. This class is not meant to be used to freal time control, it is
  *  for component testing purposes and demonstration.
  *
+ *  Buttons are packed into a bitmask each message so presses are found by
+ *  comparing against the previous mask. A runstop toggle is published as
+ *  soon as the press is seen, the 5Hz runstop timer is only a heartbeat.
+ *
  *  @note in order to receive joy messages from ROS the joystick path must be
  *  set with [rosparam set joy_node/dev "/dev/input/js0"] if not already set.
  *  Also, joy must be running:  [rosrun joy joy_node]
  *
  */
-class JoystickControl
+class JoystickControl : public nodelet::Nodelet
 {
  public:
-  /**
-   * Constructor registers callbacks and advertises message that will be
-   * published
-   *
-   */
   JoystickControl();
   ~JoystickControl();
 
   /**
-   * Callback for receiving new joystick state data
-   * @see sensor_messages::joy
-   * @param joy the message received from ros comms
+   * Registers callbacks and advertises messages that will be published
    */
-  void joyCallback(const sensor_msgs::Joy::ConstPtr& joy);
+  virtual void onInit();
 
-  void runstopCallback(const ros::TimerEvent& time);
+ private:
+  static const int MAX_BUTTONS = 32; ///< Number of buttons that fit in the button bitmask
 
-  ros::Subscriber m_joySub; ///< Channel to receive joystick state
+  ros::Subscriber joySub_; ///< Channel to receive joystick state
   ros::Publisher commandPub_; ///< publisher for chassis commands
   ros::Publisher runstopPub_; ///< publisher for runstop commands
-  ros::Timer runstopTimer_;
-
- private:
-  ros::NodeHandle nh_;
+  ros::Timer runstopTimer_; ///< heartbeat for runstop messages
 
-  autorally_msgs::chassisCommand chassis_command_; ///< command message
-  autorally_msgs::runstop runstop_; ///< command message
+  autorally_msgs::chassisCommandPtr chassisCommand_; ///< command message, reused once subscribers release it
+  autorally_msgs::runstopPtr runstop_; ///< runstop message, reused once subscribers release it
+  bool motionEnabled_; ///< current runstop state
+  boost::mutex runstopMutex_; ///< mutex for runstop_ and motionEnabled_, the heartbeat fires in another thread
   double throttleDamping_;
   double steeringDamping_;
   
   bool throttleEnabled_;
   bool steeringEnabled_;
-  bool throttleBrakePaired_;
-  bool frontBrake_;
 
   int throttleAxis_;
   int steeringAxis_;
   int brakeAxis_;
-  int throttleEnableButton_;
-  int steeringEnableButton_;
-  std::vector<int> runstopToggleButtons_;
-  sensor_msgs::Joy prevJoy_;
+  uint32_t runstopToggleMask_; ///< bit set for each runstop toggle button
+  uint32_t throttleEnableMask_; ///< bit set for the throttle enable button
+  uint32_t steeringEnableMask_; ///< bit set for the steering enable button
+  uint32_t prevButtons_; ///< button bitmask from the previous joy message
+
+  /**
+   * Callback for receiving new joystick state data
+   * @see sensor_messages::joy
+   * @param joy the message received from ros comms
+   */
+  void joyCallback(const sensor_msgs::Joy::ConstPtr& joy);
+
+  /**
+   * Timer triggered heartbeat for the current runstop state
+   * @param time information about callback firing
+   */
+  void runstopCallback(const ros::TimerEvent& time);
+
+  /**
+   * Publish the current runstop state, runstopMutex_ must be held
+   */
+  void publishRunstop();
+
+  /**
+   * Convert a configured button index into a bit in the button bitmask
+   * @param button index of the button in sensor_msgs::Joy::buttons
+   * @return uint32_t bitmask with the button set, 0 if the index is invalid
+   */
+  uint32_t buttonMask(int button);
 };
 
+}
 #endif //JOYSTICK_CONTROL_H_
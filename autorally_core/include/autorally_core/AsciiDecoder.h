@@ -0,0 +1,458 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file AsciiDecoder.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Table driven decoders for the '#key:val,...\r\n' microcontroller protocols
+ *
+ * @details The Arduinos on the vehicle all send ASCII frames that start with
+ *          '#', end with "\r\n" and hold one or more '\n' separated records of
+ *          the form key:value,value,... A protocol is described by a plain
+ *          struct that receives the values and a table that maps each key to
+ *          the struct members its values are stored in, in order:
+ *
+ *          struct Data { double lf, rf; long fps; };
+ *          const AsciiKey<Data> keys[] = {
+ *            {"wheels", &AsciiRecord<Data, AsciiField<Data, double, &Data::lf>,
+ *                                          AsciiField<Data, double, &Data::rf> >::parse},
+ *            {"fps", &AsciiRecord<Data, AsciiField<Data, long, &Data::fps> >::parse} };
+ *          AsciiDecoder<Data> decoder(keys);
+ *
+ *          Decoding works in place on the receive buffer and never allocates.
+ *          Values of other types are supported by overloading
+ *          parseAsciiValue(const char* begin, const char* end, T& value).
+ ***********************************************/
+#ifndef AUTORALLY_ASCII_DECODER_H_
+#define AUTORALLY_ASCII_DECODER_H_
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdint.h>
+#include <string>
+
+namespace autorally_core
+{
+
+/**
+ * @brief Parse a decimal integer filling [begin, end)
+ * @return false if the text is empty, has other characters or overflows
+ */
+template<typename T>
+inline bool parseAsciiInteger(const char* begin, const char* end, T& value)
+{
+  bool negative = false;
+  if(begin != end && (*begin == '-' || *begin == '+'))
+  {
+    negative = (*begin == '-');
+    if(negative && !std::numeric_limits<T>::is_signed)
+    {
+      return false;
+    }
+    ++begin;
+  }
+  if(begin == end)
+  {
+    return false;
+  }
+
+  uint64_t magnitude = 0;
+  for(; begin != end; ++begin)
+  {
+    unsigned int digit = static_cast<unsigned char>(*begin)-'0';
+    if(digit > 9 || magnitude > (std::numeric_limits<uint64_t>::max()-digit)/10)
+    {
+      return false;
+    }
+    magnitude = magnitude*10+digit;
+  }
+
+  if(negative)
+  {
+    if(magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max())+1)
+    {
+      return false;
+    }
+    value = static_cast<T>(~magnitude+1);
+  } else
+  {
+    if(magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+    {
+      return false;
+    }
+    value = static_cast<T>(magnitude);
+  }
+  return true;
+}
+
+inline bool parseAsciiValue(const char* begin, const char* end, int& value)
+{
+  return parseAsciiInteger(begin, end, value);
+}
+
+inline bool parseAsciiValue(const char* begin, const char* end, long& value)
+{
+  return parseAsciiInteger(begin, end, value);
+}
+
+inline bool parseAsciiValue(const char* begin, const char* end, unsigned int& value)
+{
+  return parseAsciiInteger(begin, end, value);
+}
+
+inline bool parseAsciiValue(const char* begin, const char* end, unsigned long& value)
+{
+  return parseAsciiInteger(begin, end, value);
+}
+
+/**
+ * @brief Parse a decimal number as printed by Arduino Serial.print, including nan
+ * @return false if the text is not a number, inf and ovf are rejected
+ */
+inline bool parseAsciiValue(const char* begin, const char* end, double& value)
+{
+  if(end-begin == 3 && std::strncmp(begin, "nan", 3) == 0)
+  {
+    value = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+
+  bool negative = false;
+  if(begin != end && (*begin == '-' || *begin == '+'))
+  {
+    negative = (*begin == '-');
+    ++begin;
+  }
+
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  int digits = 0;
+  bool point = false;
+  for(; begin != end; ++begin)
+  {
+    if(*begin == '.' && !point)
+    {
+      point = true;
+      continue;
+    }
+    unsigned int digit = static_cast<unsigned char>(*begin)-'0';
+    if(digit > 9)
+    {
+      break;
+    }
+    ++digits;
+    //digits past what the mantissa holds only change the scale
+    if(mantissa < 100000000000000000ULL)
+    {
+      mantissa = mantissa*10+digit;
+      exponent -= point;
+    } else
+    {
+      exponent += !point;
+    }
+  }
+  if(digits == 0)
+  {
+    return false;
+  }
+
+  if(begin != end)
+  {
+    if(*begin != 'e' && *begin != 'E')
+    {
+      return false;
+    }
+    int scale = 0;
+    if(!parseAsciiInteger(begin+1, end, scale) || scale > 400 || scale < -400)
+    {
+      return false;
+    }
+    exponent += scale;
+  }
+
+  static const double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+                                   1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  double result = static_cast<double>(mantissa);
+  while(exponent > 22)
+  {
+    result *= 1e22;
+    exponent -= 22;
+  }
+  while(exponent < -22)
+  {
+    result /= 1e22;
+    exponent += 22;
+  }
+  result = (exponent < 0) ? result/powers[-exponent] : result*powers[exponent];
+  value = negative ? -result : result;
+  return true;
+}
+
+inline bool parseAsciiValue(const char* begin, const char* end, float& value)
+{
+  double parsed;
+  if(!parseAsciiValue(begin, end, parsed))
+  {
+    return false;
+  }
+  value = static_cast<float>(parsed);
+  return true;
+}
+
+/**
+ * @class AsciiField AsciiDecoder.h
+ * "autorally_core/AsciiDecoder.h"
+ * @brief One value of a record, stored in Member of the protocol struct
+ */
+template<typename Message, typename T, T Message::*Member>
+struct AsciiField
+{
+  static bool parse(const char* begin, const char* end, Message& msg)
+  {
+    return parseAsciiValue(begin, end, msg.*Member);
+  }
+};
+
+/**
+ * @class AsciiRecord AsciiDecoder.h
+ * "autorally_core/AsciiDecoder.h"
+ * @brief Comma separated values of one key, one AsciiField per value
+ *
+ * A record must have exactly as many values as fields. Values are parsed in
+ * order and stop at the first bad one, so on failure the struct may hold
+ * some of the new values.
+ */
+template<typename Message, typename... Fields>
+struct AsciiRecord
+{
+  static bool parse(const char* begin, const char* end, Message& msg)
+  {
+    return parseFields<Fields...>(begin, end, msg);
+  }
+
+ private:
+  template<typename Field>
+  static bool parseFields(const char* begin, const char* end, Message& msg)
+  {
+    return std::memchr(begin, ',', end-begin) == NULL && Field::parse(begin, end, msg);
+  }
+
+  template<typename Field, typename Next, typename... Rest>
+  static bool parseFields(const char* begin, const char* end, Message& msg)
+  {
+    const char* comma = static_cast<const char*>(std::memchr(begin, ',', end-begin));
+    return comma != NULL && Field::parse(begin, comma, msg) && parseFields<Next, Rest...>(comma+1, end, msg);
+  }
+};
+
+/**
+ * @struct AsciiKey
+ * @brief Table entry mapping a record key to the parser for its values
+ */
+template<typename Message>
+struct AsciiKey
+{
+  const char* key;
+  bool (*parse)(const char* begin, const char* end, Message& msg);
+};
+
+/**
+ * @struct AsciiDecoderStats
+ * @brief Error counters kept by every decoder, they only ever increase
+ */
+struct AsciiDecoderStats
+{
+  unsigned long frames;        ///< Frames decoded
+  unsigned long badFrames;     ///< Frames cut short by a new '#' or longer than the maximum
+  unsigned long droppedBytes;  ///< Bytes discarded outside of any frame
+  unsigned long unknownKeys;   ///< Records with a key not in the table
+  unsigned long badRecords;    ///< Records with the wrong number of values or a value that did not parse
+
+  AsciiDecoderStats() :
+    frames(0),
+    badFrames(0),
+    droppedBytes(0),
+    unknownKeys(0),
+    badRecords(0)
+  {}
+};
+
+/**
+ * @class AsciiDecoder AsciiDecoder.h
+ * "autorally_core/AsciiDecoder.h"
+ * @brief Frames and decodes a '#key:val,...\r\n' byte stream into Message
+ *
+ * Typical use on a SerialInterfaceThreaded data callback, with the port locked:
+ *
+ *   size_t offset = 0;
+ *   unsigned int found;
+ *   while(decoder.next(m_port.m_data, offset, data, found)) {...}
+ *   m_port.m_data.erase(0, offset);
+ */
+template<typename Message>
+class AsciiDecoder
+{
+ public:
+  static const size_t MAX_KEYS = 32; ///< Keys a protocol may have, one bit each in the found mask
+
+  /**
+   * @param keys table of the protocol's keys, must outlive the decoder
+   * @param maxFrameLength longest frame, including '#' and "\r\n", before data is treated as garbage
+   */
+  template<size_t N>
+  explicit AsciiDecoder(const AsciiKey<Message> (&keys)[N], size_t maxFrameLength = 256) :
+    m_keys(keys),
+    m_numKeys(N),
+    m_maxFrameLength(maxFrameLength)
+  {
+    static_assert(N <= MAX_KEYS, "AsciiDecoder supports at most 32 keys");
+    for(size_t i = 0; i < N; i++)
+    {
+      m_keyLengths[i] = std::strlen(keys[i].key);
+    }
+  }
+
+  /**
+   * @brief Decode the records of one frame body, the text between '#' and "\r\n"
+   * @return bit i is set if the record for keys[i] was found and all its values parsed
+   */
+  unsigned int decodeFrame(const char* begin, const char* end, Message& msg)
+  {
+    unsigned int found = 0;
+    ++m_stats.frames;
+    while(begin < end)
+    {
+      const char* recordEnd = static_cast<const char*>(std::memchr(begin, '\n', end-begin));
+      if(recordEnd == NULL)
+      {
+        recordEnd = end;
+      }
+      if(recordEnd != begin)
+      {
+        found |= decodeRecord(begin, recordEnd, msg);
+      }
+      begin = recordEnd+1;
+    }
+    return found;
+  }
+
+  /**
+   * @brief Decode the next complete frame in buffer at or after offset
+   * @param buffer received bytes
+   * @param offset where to start looking, advanced past everything consumed
+   * @param msg receives the decoded values
+   * @param found set to the keys found in the frame, as from decodeFrame
+   * @return false when there is no complete frame left, offset then points at the start of a partial frame
+   */
+  bool next(const std::string& buffer, size_t& offset, Message& msg, unsigned int& found)
+  {
+    const char* data = buffer.data();
+    const size_t size = buffer.size();
+    while(offset < size)
+    {
+      const char* start = static_cast<const char*>(std::memchr(data+offset, '#', size-offset));
+      if(start == NULL)
+      {
+        m_stats.droppedBytes += size-offset;
+        offset = size;
+        return false;
+      }
+      m_stats.droppedBytes += (start-data)-offset;
+      offset = start-data;
+
+      //the frame ends at "\r\n", a '#' before that means the end was lost
+      const char* limit = data+std::min(size, offset+m_maxFrameLength);
+      const char* end = NULL;
+      const char* restart = NULL;
+      for(const char* c = start+1; c < limit; ++c)
+      {
+        if(*c == '#')
+        {
+          restart = c;
+          break;
+        }
+        if(*c == '\r' && c+1 < data+size && c[1] == '\n')
+        {
+          end = c;
+          break;
+        }
+      }
+
+      if(end != NULL)
+      {
+        found = decodeFrame(start+1, end, msg);
+        offset = (end-data)+2;
+        return true;
+      }
+      if(restart == NULL && limit == data+size && size-offset < m_maxFrameLength)
+      {
+        //frame is still arriving
+        return false;
+      }
+      ++m_stats.badFrames;
+      offset = (restart != NULL) ? restart-data : (limit-data);
+    }
+    return false;
+  }
+
+  const AsciiDecoderStats& stats() const {return m_stats;}
+
+ private:
+  const AsciiKey<Message>* m_keys;
+  size_t m_numKeys;
+  size_t m_keyLengths[MAX_KEYS];
+  size_t m_maxFrameLength;
+  AsciiDecoderStats m_stats;
+
+  unsigned int decodeRecord(const char* begin, const char* end, Message& msg)
+  {
+    const char* colon = static_cast<const char*>(std::memchr(begin, ':', end-begin));
+    if(colon == NULL)
+    {
+      ++m_stats.badRecords;
+      return 0;
+    }
+    size_t keyLength = colon-begin;
+    for(size_t i = 0; i < m_numKeys; i++)
+    {
+      if(keyLength == m_keyLengths[i] && std::memcmp(begin, m_keys[i].key, keyLength) == 0)
+      {
+        if(m_keys[i].parse(colon+1, end, msg))
+        {
+          return 1u << i;
+        }
+        ++m_stats.badRecords;
+        return 0;
+      }
+    }
+    ++m_stats.unknownKeys;
+    return 0;
+  }
+};
+
+}
+#endif //AUTORALLY_ASCII_DECODER_H_
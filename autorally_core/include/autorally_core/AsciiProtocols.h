@@ -0,0 +1,142 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file AsciiProtocols.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Descriptions of the ASCII protocols spoken by the vehicle's Arduinos
+ *
+ * @details Each protocol is a struct holding every value the microcontroller
+ *          sends and a key table for AsciiDecoder. The bit for a key in the
+ *          found mask returned by the decoder is given by the Key enum.
+ ***********************************************/
+#ifndef AUTORALLY_ASCII_PROTOCOLS_H_
+#define AUTORALLY_ASCII_PROTOCOLS_H_
+
+#include <autorally_core/AsciiDecoder.h>
+
+namespace autorally_core
+{
+
+/**
+ * @struct ArduinoOnboardData
+ * @brief #wheels:lf,rf,lb,rb\nrc:throttle,steering\r\n from the onboard Arduino
+ *
+ * Wheel speeds are in rotations per second, RC pulse widths in units of 500 ns.
+ */
+struct ArduinoOnboardData
+{
+  enum Key {WHEELS = 1<<0, RC = 1<<1};
+
+  double lf;
+  double rf;
+  double lb;
+  double rb;
+  double rcThrottle;
+  double rcSteering;
+};
+
+static const AsciiKey<ArduinoOnboardData> arduinoOnboardKeys[] =
+{
+  {"wheels", &AsciiRecord<ArduinoOnboardData,
+                          AsciiField<ArduinoOnboardData, double, &ArduinoOnboardData::lf>,
+                          AsciiField<ArduinoOnboardData, double, &ArduinoOnboardData::rf>,
+                          AsciiField<ArduinoOnboardData, double, &ArduinoOnboardData::lb>,
+                          AsciiField<ArduinoOnboardData, double, &ArduinoOnboardData::rb> >::parse},
+  {"rc", &AsciiRecord<ArduinoOnboardData,
+                      AsciiField<ArduinoOnboardData, double, &ArduinoOnboardData::rcThrottle>,
+                      AsciiField<ArduinoOnboardData, double, &ArduinoOnboardData::rcSteering> >::parse}
+};
+
+/**
+ * @struct CameraTriggerData
+ * @brief #pps:count\r\n, #fps:rate\r\n and #trg:seq,us,ppsCount,ppsUs\r\n from the camera trigger Arduino
+ */
+struct CameraTriggerData
+{
+  enum Key {PPS = 1<<0, FPS = 1<<1, TRIGGER = 1<<2};
+
+  unsigned long ppsCount;     ///< PPS pulses received
+  unsigned long fps;          ///< Triggering rate
+  uint32_t triggerSeq;        ///< Count of trigger pulses
+  uint32_t triggerUs;         ///< Microcontroller time of the trigger rising edge
+  uint32_t triggerPpsCount;   ///< PPS pulses received before the trigger
+  uint32_t triggerPpsUs;      ///< Microcontroller time of the PPS pulse before the trigger
+};
+
+static const AsciiKey<CameraTriggerData> cameraTriggerKeys[] =
+{
+  {"pps", &AsciiRecord<CameraTriggerData,
+                       AsciiField<CameraTriggerData, unsigned long, &CameraTriggerData::ppsCount> >::parse},
+  {"fps", &AsciiRecord<CameraTriggerData,
+                       AsciiField<CameraTriggerData, unsigned long, &CameraTriggerData::fps> >::parse},
+  {"trg", &AsciiRecord<CameraTriggerData,
+                       AsciiField<CameraTriggerData, uint32_t, &CameraTriggerData::triggerSeq>,
+                       AsciiField<CameraTriggerData, uint32_t, &CameraTriggerData::triggerUs>,
+                       AsciiField<CameraTriggerData, uint32_t, &CameraTriggerData::triggerPpsCount>,
+                       AsciiField<CameraTriggerData, uint32_t, &CameraTriggerData::triggerPpsUs> >::parse}
+};
+
+/**
+ * @struct RunStopBoxData
+ * @brief #estopstate:RED|YELLOW|GREEN\r\n from the run stop box
+ */
+struct RunStopBoxData
+{
+  enum Key {STATE = 1<<0};
+
+  enum State
+  {
+    RED = 0, ///< Red or kill button pressed, or no state received yet
+    YELLOW,  ///< Yellow button pressed
+    GREEN    ///< Green button pressed, motion enabled
+  };
+
+  State state;
+};
+
+inline bool parseAsciiValue(const char* begin, const char* end, RunStopBoxData::State& value)
+{
+  static const char* names[] = {"RED", "YELLOW", "GREEN"};
+  for(int i = 0; i < 3; i++)
+  {
+    if(static_cast<size_t>(end-begin) == std::strlen(names[i]) && std::memcmp(begin, names[i], end-begin) == 0)
+    {
+      value = static_cast<RunStopBoxData::State>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+static const AsciiKey<RunStopBoxData> runStopBoxKeys[] =
+{
+  {"estopstate", &AsciiRecord<RunStopBoxData,
+                              AsciiField<RunStopBoxData, RunStopBoxData::State, &RunStopBoxData::state> >::parse}
+};
+
+}
+#endif //AUTORALLY_ASCII_PROTOCOLS_H_
@@ -0,0 +1,143 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file BicycleModel.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Kinematic bicycle model of an AutoRally vehicle
+ *
+ * @details The model used by ChassisSimulator. It has no ROS dependencies so
+ *          it can be stepped directly by tests and benchmarks.
+ ***********************************************/
+#ifndef AUTORALLY_BICYCLE_MODEL_H_
+#define AUTORALLY_BICYCLE_MODEL_H_
+
+namespace autorally_core
+{
+
+/**
+ *  @class BicycleModel BicycleModel.h
+ *  "autorally_core/BicycleModel.h"
+ *  @brief Kinematic bicycle model driven by chassisCommand values
+ *
+ *  The front wheel angle follows the steering command with a rate limit. The
+ *  throttle accelerates the vehicle with a force that falls off linearly to
+ *  zero at maxSpeed, negative throttle and the front brake decelerate it and
+ *  the vehicle never rolls backwards. Position and heading are integrated at
+ *  the center of mass with the kinematic slip angle, so there is no tire slip.
+ *
+ *  The world frame is x east, y north, with yaw counterclockwise from east.
+ *  A positive steering command turns right, like the AutoRally chassis.
+ */
+class BicycleModel
+{
+ public:
+  struct Params
+  {
+    double wheelbase;        ///< Distance between the axles in m
+    double rearAxleToCg;     ///< Distance from the rear axle to the center of mass in m
+    double track;            ///< Distance between the left and right wheels in m
+    double maxSteeringAngle; ///< Front wheel angle at a steering command of 1 in rad
+    double steeringRate;     ///< Maximum rate of change of the front wheel angle in rad/s
+    double maxAcceleration;  ///< Acceleration at full throttle from a standstill in m/s^2
+    double maxSpeed;         ///< Speed at which full throttle stops accelerating in m/s
+    double maxDeceleration;  ///< Deceleration at full brake or full negative throttle in m/s^2
+    double drag;             ///< Deceleration proportional to speed in 1/s
+
+    Params() :
+      wheelbase(0.57),
+      rearAxleToCg(0.3),
+      track(0.44),
+      maxSteeringAngle(0.436),
+      steeringRate(4.0),
+      maxAcceleration(6.0),
+      maxSpeed(25.0),
+      maxDeceleration(8.0),
+      drag(0.1)
+    {}
+  };
+
+  struct State
+  {
+    double x;             ///< East position of the center of mass in m
+    double y;             ///< North position of the center of mass in m
+    double yaw;           ///< Heading in rad on [-pi, pi]
+    double speed;         ///< Speed of the center of mass in m/s, never negative
+    double steeringAngle; ///< Front wheel angle in rad, positive to the left
+    double slipAngle;     ///< Angle between the heading and the velocity in rad
+    double yawRate;       ///< Yaw rate in rad/s
+    double longitudinalAcceleration; ///< Body frame forward acceleration in m/s^2
+    double lateralAcceleration;      ///< Body frame leftward acceleration in m/s^2
+
+    State() :
+      x(0.0),
+      y(0.0),
+      yaw(0.0),
+      speed(0.0),
+      steeringAngle(0.0),
+      slipAngle(0.0),
+      yawRate(0.0),
+      longitudinalAcceleration(0.0),
+      lateralAcceleration(0.0)
+    {}
+  };
+
+  /**
+   * @brief Ground speed of each wheel in m/s
+   */
+  struct WheelSpeeds
+  {
+    double lf;
+    double rf;
+    double lb;
+    double rb;
+  };
+
+  explicit BicycleModel(const Params& params = Params());
+
+  const Params& params() const {return m_params;}
+
+  /**
+   * @brief Advance a state by one time step
+   * @param state state at the start of the step, replaced by the state at the end of it
+   * @param steering steering command on [-1, 1], positive turns right
+   * @param throttle throttle command on [-1, 1], negative brakes
+   * @param frontBrake front brake command on [0, 1]
+   * @param dt length of the step in s
+   */
+  void step(State& state, double steering, double throttle, double frontBrake, const double dt) const;
+
+  /**
+   * @brief Speed of each wheel for a state, front wheels rolling in their steered direction
+   */
+  WheelSpeeds wheelSpeeds(const State& state) const;
+
+ private:
+  Params m_params;
+};
+
+}
+#endif //AUTORALLY_BICYCLE_MODEL_H_
@@ -0,0 +1,147 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file ChassisArbiter.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief ChassisArbiter class definition
+ *
+ ***********************************************/
+#ifndef CHASSIS_ARBITER_H_
+#define CHASSIS_ARBITER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+
+#include <ros/ros.h>
+#include <ros/time.h>
+#include <autorally_msgs/chassisCommand.h>
+#include <autorally_msgs/chassisState.h>
+#include <autorally_msgs/runstop.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class ChassisArbiter ChassisArbiter.h
+ *  "autorally_core/ChassisArbiter.h"
+ *  @brief Chooses which chassisCommand drives each actuator
+ *
+ *  Commanders and their priorities are read from chassisCommandProirities,
+ *  and each commander's <id>/chassisCommand topic is subscribed along with
+ *  /runstop. arbitrate() gives each actuator to the highest priority
+ *  commander (0 is highest) with a command that is valid for it and younger
+ *  than commandMaxAge. Throttle is only given out while motion is enabled,
+ *  which requires at least one runstop younger than runstopMaxAge and none of
+ *  those disabling motion.
+ *
+ *  Shared by AutoRallyChassis and ChassisSimulator so simulated runs follow
+ *  the same rules as the vehicle.
+ */
+class ChassisArbiter
+{
+ public:
+  ChassisArbiter();
+
+  /**
+   * @brief Load the commander priorities and subscribe to commands and runstops
+   * @param nh node handle the command and runstop topics are resolved in
+   * @param nhPvt node handle holding chassisCommandProirities, commandMaxAge and runstopMaxAge
+   * @param name name used in log messages
+   * @return if the maximum ages were found
+   */
+  bool init(ros::NodeHandle& nh, ros::NodeHandle& nhPvt, const std::string& name);
+
+  /**
+   * @brief Choose the commander and value of each actuator
+   * @param currentTime time commands and runstops are aged against
+   * @param state receives the runstop state and each actuator's commander and value, actuators without a valid
+   *        commander are set to 0 with an empty commander
+   * @return stamp of the throttle command that won, zero if none did
+   */
+  ros::Time arbitrate(const ros::Time& currentTime, autorally_msgs::chassisState& state);
+
+ private:
+  /*
+   * @struct priorityEntry
+   * @brief Entry for each chassis commander loaded from the commanders file. The highest priority is 0.
+   *
+   * @note the id must be the same as the sender in received chassisCommand messages
+   */
+  struct priorityEntry
+  {
+    std::string id; ///< Unique identifying string for a program that will control the chassis
+    unsigned int priority; ///< Priority of the commander, 0 is highest priotity
+  };
+
+  struct priorityComparator
+  {
+    bool operator() (const priorityEntry& a, const priorityEntry& b)
+    {
+      return a.priority < b.priority;
+    }
+  };
+
+  std::string name_; ///< Name of the owner for log messages
+  boost::mutex mutex_; ///< Guards chassisCommands_ and runstops_ between callbacks and arbitrate()
+
+  std::map<std::string, ros::Subscriber> chassisCommandSub_; ///< Map of chassisCommand subscribers, one for each
+                                                             ///< for each chassis commander in the priorities file
+  ros::Subscriber runstopSub_; ///< Subscriber for all incoming runstop messages
+  ros::Duration chassisCommandMaxAge_; ///< Maximum age to consider a received chassisCommand message valid
+  ros::Duration runstopMaxAge_; ///< Maximum age to consider a received runstop message valid
+
+  std::map<std::string, autorally_msgs::chassisCommand> chassisCommands_; ///< Map of the most recently received chassis
+                                                                          ///< command from each commander
+  std::map<std::string, autorally_msgs::runstop> runstops_; ///< Map of the most recently received runstop message from
+                                                            ///< all nodes publishing the message
+  std::vector<priorityEntry> chassisCommandPriorities_; ///< Priority list used to choose which commander controls the
+                                                        ///< actuators
+
+  /**
+   * @brief Callback for receiving control messages
+   * @param msg the chassisCommand message received from ros comms
+   */
+  void chassisCommandCallback(const autorally_msgs::chassisCommandConstPtr& msg);
+
+  /**
+   * @brief Callback for incoming runstop messages
+   * @param msg the runstop message received from ros comms
+   */
+  void runstopCallback(const autorally_msgs::runstopConstPtr& msg);
+
+  /**
+   * @brief Loads list of actuator commanders with priorities loaded onto the parameter server from the .yaml
+   *        file specified in the launch file.
+   */
+  void loadChassisCommandPriorities(ros::NodeHandle& nhPvt);
+};
+
+}
+#endif //CHASSIS_ARBITER_H_
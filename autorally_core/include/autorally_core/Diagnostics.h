@@ -53,6 +53,11 @@
  *  @note If a diagnostic publishing frequency other than 1s is required, define
  *  diagnosticsFrequency double in the parameter server with desired frequency.
  *  This sets the publish fequency of all diagnostics in the system.
+ *  @note If the diagnosticsImmediate bool is true in the parameter server, a
+ *  WARN or ERROR message that raises the level above what was last published
+ *  triggers an immediate publish instead of waiting for the next period. These
+ *  extra publishes are at least diagnosticsImmediateInterval seconds (0.1s
+ *  default) apart, so a persistent fault does not raise the publishing rate.
  *  @note If the same message is queued between diagnostics being pubished, only
  *  one will be included in the next diagnostics message sent. There is no
  *  guarantee as to the level of the message if multiple messages were queued
@@ -139,11 +144,24 @@ class Diagnostics
   std::map<std::string, char> m_diagMsgs; ///< map of pending diagnostic messages
   std::map<std::string, std::string> m_diags; ///< map of pending standard messages
   unsigned char m_overallLevel; ///< overall status level of the message
+  unsigned char m_pendingLevel; ///< highest level of the pending diagnostic messages
+  unsigned char m_publishedLevel; ///< highest level of the messages in the last publish
+  bool m_immediate; ///< whether level escalations are published immediately
+  ros::WallDuration m_immediateInterval; ///< minimum time between immediate publishes
+  ros::WallTime m_lastImmediate; ///< time of the last immediate publish
   ///< Holds tick frequency counters
   std::map<std::string, std::vector<std::pair<int, ros::Time> > > m_ticks;
 
   boost::mutex m_dataMutex; ///< mutex for accessing data
 
+  /**
+    * @brief Record the level of a queued message and decide if it should be published immediately
+    * @param level the level of the queued message
+    * @return bool if the level was raised and the rate limit allows an immediate publish
+    * @note m_dataMutex must be locked by the caller
+    */
+  bool escalate(const unsigned char level);
+
   /**
     * @brief Timer triggered callback to force publishing of diagnostics
     * @param time information about callback execution
@@ -38,7 +38,11 @@
 #include <iostream>
 #include <stdio.h>
 #include <string>
-#include <queue>
+#include <deque>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread_time.hpp>
 
 #include <ros/ros.h>
 #include <nodelet/nodelet.h>
@@ -50,6 +54,7 @@
 #define MAX_CONTROL_VALUE 254 ///< Allowable control values are [0-254]
 #define SERVO_NEUTRAL_VALUE 127 ///< Middle value that puts servo in neutral
 #define SERVO_HOME_POSITION 255 ///< Sends the servo to its 'home' position
+#define MAESTRO_MAX_CHANNELS 24 ///< Channels on the largest Maestro
 
 /**
  *  @class PololuMaestro PololuMaestro.h
@@ -69,6 +74,10 @@
  *  full back brake.
  *  Front brak vales are from [0-127] 127 is full front brake.
  *
+ *  Replies to position and error requests are parsed by the serial port's
+ *  read thread, in the order the requests were sent, so callers never read
+ *  the port themselves.
+ *
  *  @see http://www.pololu.com/docs/0J40 for documentation of the servo
  *       controller protocol
  *
@@ -106,7 +115,46 @@ class PololuMaestro
   void setTargetMS(const unsigned char channel, const unsigned int target);
 
   /**
-   * @brief Sends a low level get command over serial to set the position of a servo
+   * @brief Set several channels with a single write
+   *
+   * Uses the compact Set Multiple Targets command when the controller
+   * supports it and the channels are consecutive and ascending, otherwise
+   * sends one Set Target command per channel in the same write.
+   *
+   * @param channels channel of each target
+   * @param targets pulse width of each channel in 1/4 ms
+   * @param count number of channels to set
+   */
+  void setTargetsMS(const unsigned char* channels, const unsigned int* targets, const unsigned int count);
+
+  /**
+   * @brief Set Multiple Targets is only available on the Mini Maestro 12, 18 and 24
+   */
+  void setMultipleTargetsSupported(const bool supported) {m_multipleTargets = supported;}
+
+  /**
+   * @brief Request the position of a channel without waiting for the reply
+   *
+   * @param channel on servo controller to read from
+   */
+  void requestTarget(const unsigned char channel);
+
+  /**
+   * @brief Most recent position received for a channel
+   *
+   * @param channel on servo controller
+   * @param target set to the position in 1/4 ms
+   * @return false if no position has been received for the channel
+   */
+  bool lastTarget(const unsigned char channel, unsigned short& target);
+
+  /**
+   * @brief Request the error register without waiting for the reply, errors are reported to diagnostics
+   */
+  void requestErrors();
+
+  /**
+   * @brief Requests the position of a servo and waits briefly for the reply
    *
    * @param channel on servo controller to read from
    * @return Value [0-254] of requested channel (127 is neutral)
@@ -121,6 +169,38 @@ class PololuMaestro
   SerialInterfaceThreaded m_serialPort;
 
  private:
+  static const int ERRORS_REPLY = -1; ///< Pending reply entry for the error register
+  static const int REPLY_TIMEOUT_MS = 100; ///< A reply later than this is treated as lost
+
+  struct PendingReply
+  {
+    int request; ///< Channel, or ERRORS_REPLY
+    boost::system_time deadline; ///< When the reply is considered lost
+
+    explicit PendingReply(const int r):
+      request(r),
+      deadline(boost::get_system_time() + boost::posix_time::milliseconds(REPLY_TIMEOUT_MS))
+    {}
+  };
+
+  boost::mutex m_replyMutex;
+  boost::condition_variable m_replyReceived;
+  std::deque<PendingReply> m_pendingReplies; ///< Requests still waiting for their reply, in send order
+  unsigned short m_targets[MAESTRO_MAX_CHANNELS];
+  bool m_targetValid[MAESTRO_MAX_CHANNELS];
+  bool m_multipleTargets;
+
+  /**
+   * @brief Called by the serial read thread to match received bytes to pending requests
+   */
+  void serialDataCallback();
+
+  /**
+   * @brief Forget all pending requests and buffered bytes so replies line up again
+   *
+   * The caller must hold both the serial port lock and m_replyMutex.
+   */
+  void flushReplies();
 
 };
 
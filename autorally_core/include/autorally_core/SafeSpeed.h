@@ -34,18 +34,16 @@
 #ifndef SAFE_SPEED_H_
 #define SAFE_SPEED_H_
 
-#include <vector>
+#include <array>
+#include <string>
 
-#include <boost/circular_buffer.hpp>
+#include <boost/thread.hpp>
 
 #include <ros/ros.h>
 #include <ros/time.h>
 #include <nodelet/nodelet.h>
 #include <autorally_msgs/safeSpeed.h>
 #include <autorally_msgs/wheelSpeeds.h>
-#include <autorally_core/RingBuffer.h>
-
-#warning autorally_core/safeSpeed.h has been deprecated, refer to autorally_chassis
 
 namespace autorally_core
 {
@@ -53,23 +51,32 @@ namespace autorally_core
 /**
  *  @class SafeSpeed SafeSpeed.h
  *  "autorally_core/SafeSpeed.h"
- *  @brief Given current wheel speed information, generate a maximum throttle
- *         servo position to not drive faster than is considered "safe"
+ *  @brief Given current wheel speed information, limit the throttle so the
+ *         vehicle does not drive faster than is considered "safe"
  *
  *  Each node can publish what it believes to be the maximum safe speed the
- *  vehicle can travel, and safe speed computes a throttle servo position that
- *  limits the velocity of the vehicle to the minimum safe speed published. If
- *  there are no outside nodes commanding the throttle, SafeSpeed also acts as
- *  a constant speed controller for the vehicle, driving it at the minimum safe
- *  speed it receives.
+ *  vehicle can travel, and SafeSpeed cuts the throttle whenever the vehicle
+ *  exceeds the minimum valid safe speed published. AutoRallyChassis owns an
+ *  instance and applies safeThrottle() to the arbitrated throttle command.
+ *  Loaded on its own as a nodelet, SafeSpeed republishes the current speed
+ *  ceiling on safeSpeed/limit for monitoring.
+ *
+ *  Senders are kept in a fixed array of slots and the minimum safe speed is
+ *  recomputed when a message arrives, so a query from the command path is a
+ *  comparison against cached values. The cache is only rebuilt when the
+ *  sender that set the minimum times out.
  */
 class SafeSpeed : public nodelet::Nodelet
 {
+  static const int MAX_SENDERS = 16; ///< Maximum number of distinct safeSpeed senders
+  static constexpr double EXPIRE_CHECK_PERIOD = 0.1; ///< Period in s to expire senders when loaded as a nodelet
+
   /**
     *@brief Internal container for received safeSpeed values
     */
   struct SafeSpeedData
   {
+    std::string sender;
     ros::Time time;
     double safeSpeed;
   };
@@ -79,18 +86,26 @@ class SafeSpeed : public nodelet::Nodelet
    * @brief Constructor for SafeSpeed
    *
    */
-  ROS_DEPRECATED SafeSpeed();
+  SafeSpeed();
   ~SafeSpeed();
 
   virtual void onInit();
-  void init(ros::NodeHandle &nh);
 
   /**
-   * @brief Calculates the current maximum safe speed.
+   * @brief Load parameters and subscribe to safeSpeed and wheelSpeeds
+   * @param nh NodeHandle the topics are resolved in
+   * @param nhPvt NodeHandle containing the safeSpeed/ parameters
+   */
+  void init(ros::NodeHandle &nh, ros::NodeHandle &nhPvt);
+
+  /**
+   * @brief Get the current maximum safe speed.
    *
-   * @return double The maximum safe speed in m/s
+   * @param now the current time, used to expire old safeSpeed messages
+   * @return double The maximum safe speed in m/s, -1.0 if there is no valid
+   *         safeSpeed
    */
-  double getSafeSpeed() const;
+  double getSafeSpeed(const ros::Time& now);
 
   /**
    * @brief Sets the maximum safe speed.
@@ -107,37 +122,67 @@ class SafeSpeed : public nodelet::Nodelet
   double maxSpeed() const;
 
   /**
-   * @brief Calculates the current maximum safe speed.
+   * @brief Limit a throttle command so the vehicle stays under the safe speed
    *
    * @param throttleCommand the desired throttle value (from external source)
-   * @return double The safeThrottleValue. It will be less than or equal to
+   * @param now the current time
+   * @return double The safe throttle value. It will be less than or equal to
    *         throttleCommand
    *
-   * In addition to monitoring that the vehicle does not exceed the safeSpeed,
-   * safeThrottle can produce an alternate throttle position that drives the
-   * vehicle at the safeSpeed.
+   * Once the vehicle reaches the safe speed, positive throttle is cut until
+   * the commander requests less throttle than it did when the limit engaged.
+   * Braking (negative throttle) is always passed through. Without a wheel
+   * speed younger than safeSpeed/wheelSpeedMaxAge the vehicle speed is
+   * unknown, and positive throttle is cut as if there were no safe speed.
    */
-  double safeThrottle(const double& throttleCommand);
+  double safeThrottle(const double& throttleCommand, const ros::Time& now);
+
+  /**
+   * @brief Whether the most recent call to safeThrottle() limited the throttle
+   */
+  bool inControl() const {return m_safeSpeedIsInControl;}
 
  private:
-  struct WheelData {
-    autorally_msgs::wheelSpeeds msg;
-    double speed;
-  };
- 
   ros::Subscriber m_safeSpeedSub; ///< Subscriber for SafeSpeed messages
   ros::Subscriber m_speedSub; ///< Subscriber for current vehicle speed
-  std::map<std::string, SafeSpeedData > m_safeSpeeds; ///< SafeSpeeds
-  double m_safeSpeedTimeout; ///< Maximum time to consider a safeSpeed valid
+  ros::Publisher m_limitPub; ///< Publisher for the current speed ceiling, only used when loaded as a nodelet
+  ros::Timer m_expireTimer; ///< Expires stale senders so the limit is republished, only used when loaded as a nodelet
+
+  boost::mutex m_safeSpeedMutex; ///< mutex for the sender slots and cached minimum
+  std::array<SafeSpeedData, MAX_SENDERS> m_safeSpeeds; ///< Most recent safeSpeed from each sender
+  int m_numSenders; ///< Number of slots in m_safeSpeeds in use
+  double m_cachedSafeSpeed; ///< Minimum valid safeSpeed, -1.0 if none is valid
+  ros::Time m_cachedValidUntil; ///< Time the sender that set m_cachedSafeSpeed times out
+
+  ros::Duration m_safeSpeedTimeout; ///< Maximum time to consider a safeSpeed valid
   double m_maxSafeSpeed; ///< Maximum speed that vehicle can go
 
-  boost::circular_buffer<WheelData> m_vehicleSpeeds;
+  double m_vehicleSpeed; ///< Most recent front wheel speed in m/s
+  int m_vehicleSpeedCount; ///< Number of wheelSpeeds messages received, saturates at 2
+  ros::Time m_vehicleSpeedTime; ///< Stamp of the wheelSpeeds message m_vehicleSpeed came from
+  ros::Duration m_wheelSpeedMaxAge; ///< Maximum age of m_vehicleSpeed to limit the throttle against
 
   double m_prevGoodThrottle;
   bool m_safeSpeedIsInControl;
-  
-  RingBuffer<double> m_throttleMappings;
-    
+
+  /**
+   * @brief Recompute the cached minimum safe speed, m_safeSpeedMutex must be held
+   * @param now time used to decide which senders are still valid
+   */
+  void updateSafeSpeed(const ros::Time& now);
+
+  /**
+   * @brief Publish the cached limit on safeSpeed/limit if advertised, m_safeSpeedMutex must be held
+   * @param stamp header stamp of the published limit
+   */
+  void publishLimit(const ros::Time& stamp);
+
+  /**
+   * @brief Time triggered callback that expires stale senders and publishes the new limit
+   * @param time information about callback firing
+   */
+  void expireTimerCallback(const ros::TimerEvent& time);
+
   /**
    * @brief Callback for safe speed values
    * @param msg the message received from ros comms
@@ -149,8 +194,6 @@ class SafeSpeed : public nodelet::Nodelet
    * @param msg the message received from ros comms
    */
   void wheelSpeedsCallback(const autorally_msgs::wheelSpeedsConstPtr& msg);
-  
-  void loadThrottleCalibration(ros::NodeHandle &nh);
 };
 
 }
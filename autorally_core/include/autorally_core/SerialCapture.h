@@ -0,0 +1,94 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file SerialCapture.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief SerialCapture class definition
+ *
+ ***********************************************/
+#ifndef SERIAL_CAPTURE_H_
+#define SERIAL_CAPTURE_H_
+
+#include <stdint.h>
+
+#include <fstream>
+#include <string>
+
+#include <ros/time.h>
+
+/**
+ *  @class SerialCapture SerialCapture.h
+ *  "autorally_core/SerialCapture.h"
+ *  @brief Reads and writes time stamped serial data capture files
+ *
+ *  A capture file records the chunks of bytes read from a serial device and
+ *  when each chunk arrived, so the stream can be replayed later with the same
+ *  timing. The file starts with a magic line followed by one record per chunk:
+ *  a uint64 stamp in ns, a uint32 length, then the bytes, all in host byte
+ *  order.
+ *
+ *  SerialInterfaceThreaded writes a capture when its captureFile parameter is
+ *  set, and the Replay nodelet reads them back.
+ */
+class SerialCapture
+{
+ public:
+  SerialCapture();
+  ~SerialCapture();
+
+  /**
+   * @brief Create (truncate) a capture file for writing
+   * @return bool whether the file could be opened
+   */
+  bool openWrite(const std::string& filename);
+
+  /**
+   * @brief Open an existing capture file for reading
+   * @return bool whether the file could be opened and has a valid header
+   */
+  bool openRead(const std::string& filename);
+
+  bool isOpen() const {return m_file.is_open();}
+  void close();
+
+  /**
+   * @brief Append a chunk of data
+   * @param stamp time the data was received
+   */
+  void write(const ros::Time& stamp, const char* data, uint32_t length);
+
+  /**
+   * @brief Read the next chunk of data
+   * @return bool false at the end of the file or if the record is truncated
+   */
+  bool read(ros::Time& stamp, std::string& data);
+
+ private:
+  std::fstream m_file; ///< Open capture file
+};
+
+#endif //SERIAL_CAPTURE_H_
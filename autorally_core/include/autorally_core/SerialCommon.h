@@ -90,6 +90,21 @@ class SerialCommon : public Diagnostics
                const bool hardwareFlow,
                const bool softwareFlow);
 
+  /**
+    * @brief Closes the port and connects again with the settings from the last connect()
+    * @return bool if connection was successful, the port is left closed if not
+    *
+    * Used to recover when a device disappears, such as a USB-serial adapter resetting. The termios settings
+    * are reapplied because they do not survive the device being recreated. Nothing is logged while the
+    * device node does not exist, so it can be polled for the length of an outage.
+    */
+  bool reconnect();
+
+  /**
+    * @brief Closes the port if it is open
+    */
+  void disconnect();
+
   /**
     * @brief Pushes given data to file descriptor
     * @param data information to be pushed to file descriptor
@@ -130,5 +145,13 @@ class SerialCommon : public Diagnostics
   int m_fd; ///< File descriptor of connection
   std::string m_settingError; ///< Serial settings error, if exists
   struct termios m_old_port_settings;
+
+  std::string m_portPath; ///< Settings from the last connect(), reused by reconnect()
+  int m_baud;
+  std::string m_parity;
+  int m_stopBits;
+  int m_dataBits;
+  bool m_hardwareFlow;
+  bool m_softwareFlow;
 };
 #endif //SERIAL_COMMON_H_
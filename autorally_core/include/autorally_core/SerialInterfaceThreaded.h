@@ -35,6 +35,7 @@
 #define SERIAL_INTERFACE_THREADED_H_
 
 #include <autorally_core/SerialCommon.h>
+#include <autorally_core/SerialCapture.h>
 
 #include <fstream>
 #include <queue>
@@ -54,8 +55,14 @@
  *
  *  Provides the ability to open and interact with a serial device
  *  Includes functionality to automatically accumulate incoming data via a read
- *  thread that relies on select() to minimize wasted compute cycled. The read
+ *  thread that relies on poll() to minimize wasted compute cycled. The read
  *  data is avaiable in m_data.
+ *  If the device disappears (read error, end of file, or hangup) the read thread
+ *  closes the port and reopens it with exponential backoff, reapplying the serial
+ *  settings, then continues delivering data to the registered callback. The
+ *  outage duration and number of reconnects are reported in diagnostics.
+ *  If the captureFile parameter is set for the port, all data read is also
+ *  recorded to that file with its arrival time so it can be replayed later.
  *  @note locking operations are provided to ensure thread-safe data access,
  *        operations, but the user must ensure they call lock() and unlock()
  */
@@ -184,6 +191,13 @@ class SerialInterfaceThreaded : public SerialCommon
     */
   int writePortTry(const unsigned char* data, unsigned int length);
 
+  /**
+    * @brief Number of times the device was reconnected after being lost (threadsafe)
+    *
+    * Lets the user restore device state that does not survive a reconnect
+    */
+  unsigned int reconnects();
+
 
  private:
   std::string m_port; ///< Serial port to connect to
@@ -194,12 +208,33 @@ class SerialInterfaceThreaded : public SerialCommon
   boost::mutex m_waitMutex; ///< mutex for thread synchronization
 //  boost::condition_variable m_waitCond; ///< condition variable to wait for data
   DataCallback m_dataCallback; ///< Callback triggered when new data arrives
+  SerialCapture m_capture; ///< Record of incoming data, only written by the read thread
   volatile bool m_alive;
+  ros::WallTime m_outageStart; ///< When the device was lost
+  boost::mutex m_outageMutex; ///< Guards m_reconnects and m_lastOutageMs between the read thread and diagnostics
+  unsigned int m_reconnects; ///< Number of times the device was reconnected
+  double m_lastOutageMs; ///< Duration of the most recent outage
+
+  static const int RECONNECT_MIN_DELAY_MS = 10; ///< First retry delay after the device is lost
+  static const int RECONNECT_MAX_DELAY_MS = 1000; ///< Retry delay is doubled up to this value
+
   /**
     * @brief Function run as a thread that accumulates incoming data
     */
   void run();
 
+  /**
+    * @brief Close the port after the device was lost and drop the partial data from before the loss
+    * @param reason description of how the loss was detected
+    */
+  void deviceLost(const std::string& reason);
+
+  /**
+    * @brief Retry the connection with backoff until it succeeds or the read thread is stopped
+    * @return bool if the port is connected
+    */
+  bool waitForDevice();
+
   /**
     * @brief Timer triggered callback to publish a diagnostic message
     * @param time information about callback execution
@@ -0,0 +1,128 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file StatePredictor.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Predicts the vehicle state at the time a command takes effect
+ *
+ * @details A command computed from the latest pose only reaches the wheels
+ *          after chassis arbitration, the commandRate timer, the serial write
+ *          and the servo response. StatePredictor moves the newest estimator
+ *          state forward by that latency so controllers can act on where the
+ *          vehicle will be instead of where it was.
+ ***********************************************/
+#ifndef AUTORALLY_STATE_PREDICTOR_H_
+#define AUTORALLY_STATE_PREDICTOR_H_
+
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <ros/ros.h>
+#include <autorally_msgs/chassisCommand.h>
+#include <autorally_msgs/chassisState.h>
+
+#include <autorally_core/TrajectoryStore.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class StatePredictor StatePredictor.h
+ *  "autorally_core/StatePredictor.h"
+ *  @brief Forward prediction of the estimator state by the actuation latency
+ *
+ *  The newest state in the estimator's TrajectoryStore is integrated forward
+ *  assuming constant yaw rate and constant acceleration along the direction of
+ *  travel, with the acceleration taken from the recent IMU rate states. The
+ *  estimator must run in the same nodelet manager.
+ *
+ *  The latency is actuatorResponse plus the dispatch delay. The dispatch delay
+ *  is either the dispatchLatency param or, with measureLatency set, a running
+ *  average of the time from each of this commander's chassisCommand messages
+ *  to the first chassisState at or after it. When the controller publishes
+ *  faster than the chassis command rate, only the newest command before each
+ *  chassisState is measured, since that is the one the chassis applied.
+ *
+ *  Commands only feed the latency estimate. The motion over the latency is
+ *  extrapolated from the estimated states, not from the commanded steering or
+ *  throttle.
+ */
+class StatePredictor
+{
+ public:
+  StatePredictor();
+
+  /**
+   * @brief Read the latency params under nh and attach to the estimator trajectory
+   * @param nh handle the latency params are read from
+   * @param poseTopic resolved name of the estimator pose topic
+   * @param commander sender of the controller's chassisCommand messages
+   */
+  void init(ros::NodeHandle& nh, const std::string& poseTopic, const std::string& commander);
+
+  /**
+   * @brief State at now plus the actuation latency
+   * @return false if the estimator has not produced a state yet
+   */
+  bool predict(const ros::Time& now, TrajectoryStore::State& state) const;
+
+  /**
+   * @brief State at stamp, interpolated if stored and extrapolated if newer
+   */
+  bool predictAt(const ros::Time& stamp, TrajectoryStore::State& state) const;
+
+  ros::Duration latency() const;
+
+  /**
+   * @brief Integrate state forward by dt with constant yaw rate and tangential acceleration
+   */
+  static TrajectoryStore::State extrapolate(const TrajectoryStore::State& state, double acceleration, double dt);
+
+ private:
+  boost::shared_ptr<TrajectoryStore> m_trajectory;
+
+  ros::Subscriber m_chassisCommandSub;
+  ros::Subscriber m_chassisStateSub;
+  std::string m_commander;
+
+  mutable boost::mutex m_mutex;
+  static constexpr double MAX_DISPATCH_LATENCY = 0.5; ///< Longer samples are a dropped command, not latency in s
+
+  ros::Time m_lastCommandStamp;  ///< Stamp of this commander's newest command not yet paired with a chassisState
+  double m_dispatchLatency;      ///< Command to chassis write delay in s
+  double m_actuatorResponse;     ///< Chassis write to wheel response delay in s
+  double m_accelerationWindow;   ///< Span of states used to estimate acceleration in s
+
+  void chassisCommandCallback(const autorally_msgs::chassisCommandConstPtr& msg);
+  void chassisStateCallback(const autorally_msgs::chassisStateConstPtr& msg);
+};
+
+}
+
+#endif //AUTORALLY_STATE_PREDICTOR_H_
@@ -0,0 +1,167 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file Trace.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Lightweight span tracing across the sensor to actuator pipeline
+ *
+ * @details Each thread records spans into its own fixed size ring buffer, so
+ *          recording never takes a lock. Trace::writeChromeTrace() dumps the
+ *          recent contents of every buffer in the Chrome trace event format,
+ *          which can be opened in chrome://tracing or Perfetto.
+ ***********************************************/
+#ifndef AUTORALLY_TRACE_H_
+#define AUTORALLY_TRACE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <ros/time.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class Trace Trace.h
+ *  "autorally_core/Trace.h"
+ *  @brief Process wide trace recorder
+ *
+ *  A span is a named interval on one thread. Spans are linked across threads
+ *  by correlation ids: a span that produces a message sets nextId to the id of
+ *  that message, and the span that consumes it sets id to the same value. The
+ *  id of a message is its header stamp (see Trace::id()), since that is the
+ *  only header field roscpp passes through untouched. Linked spans are
+ *  exported as flow events so a wheel speed packet can be followed through the
+ *  controller to the chassis write.
+ *
+ *  Tracing is off by default, a disabled span costs one relaxed atomic load.
+ */
+class Trace
+{
+ public:
+  /**
+   * @struct Event
+   * @brief One completed span as it is exported
+   */
+  struct Event
+  {
+    const char* name; ///< Span name, must be a string literal
+    uint64_t start;   ///< Start time in ns on the steady clock
+    uint64_t end;     ///< End time in ns on the steady clock
+    uint64_t id;      ///< Correlation id of the message consumed, 0 if none
+    uint64_t nextId;  ///< Correlation id of the message produced, 0 if none
+    int tid;          ///< Kernel thread id of the recording thread
+  };
+
+  static const size_t BUFFER_SIZE = 4096; ///< Events kept per thread
+
+  /**
+   * @brief Enable or disable recording for the whole process
+   */
+  static void setEnabled(bool enabled);
+  static bool enabled() {return s_enabled.load(std::memory_order_relaxed);}
+
+  /**
+   * @brief Current time in ns on the steady clock used by all spans
+   */
+  static uint64_t now();
+
+  /**
+   * @brief Correlation id for a message
+   * @param stamp header stamp of the message
+   */
+  static uint64_t id(const ros::Time& stamp) {return stamp.toNSec();}
+
+  /**
+   * @brief Record a completed span into the calling thread's buffer
+   * @param name span name, must outlive the process (use a string literal)
+   */
+  static void record(const char* name, uint64_t start, uint64_t end, uint64_t id, uint64_t nextId);
+
+  /**
+   * @brief Copy the events currently held in all thread buffers
+   * @return events ordered by start time
+   *
+   * Safe to call while other threads are recording, events that may have been
+   * overwritten during the copy are dropped, so a full buffer yields its most
+   * recent BUFFER_SIZE-1 events.
+   */
+  static std::vector<Event> snapshot();
+
+  /**
+   * @brief Serialize events as a Chrome trace / Perfetto JSON document
+   */
+  static std::string toChromeTrace(const std::vector<Event>& events);
+
+  /**
+   * @brief Write snapshot() to a file in the Chrome trace format
+   * @return bool whether the file was written
+   */
+  static bool writeChromeTrace(const std::string& filename);
+
+ private:
+  static std::atomic<bool> s_enabled;
+};
+
+/**
+ *  @class TraceSpan Trace.h
+ *  "autorally_core/Trace.h"
+ *  @brief Records a span from construction until destruction
+ */
+class TraceSpan
+{
+ public:
+  TraceSpan(const char* name, uint64_t id = 0) :
+    m_name(name),
+    m_start(Trace::enabled() ? Trace::now() : 0),
+    m_id(id),
+    m_nextId(0)
+  {}
+
+  ~TraceSpan()
+  {
+    if(m_start)
+    {
+      Trace::record(m_name, m_start, Trace::now(), m_id, m_nextId);
+    }
+  }
+
+  void setId(uint64_t id) {m_id = id;}
+  void setNextId(uint64_t nextId) {m_nextId = nextId;}
+
+ private:
+  const char* m_name;
+  uint64_t m_start;
+  uint64_t m_id;
+  uint64_t m_nextId;
+};
+
+}
+#endif //AUTORALLY_TRACE_H_
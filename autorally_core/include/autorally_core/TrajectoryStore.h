@@ -0,0 +1,121 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TrajectoryStore.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Time indexed store of recent vehicle states
+ *
+ * @details The state estimator writes every state it publishes into a
+ *          TrajectoryStore, so nodelets in the same manager can ask where the
+ *          vehicle was at a given time without subscribing to pose and keeping
+ *          their own buffer. Other processes use the estimator's pose_at_time
+ *          service.
+ ***********************************************/
+#ifndef AUTORALLY_TRAJECTORY_STORE_H_
+#define AUTORALLY_TRAJECTORY_STORE_H_
+
+#include <deque>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <ros/time.h>
+#include <geometry_msgs/Pose.h>
+#include <geometry_msgs/Twist.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class TrajectoryStore TrajectoryStore.h
+ *  "autorally_core/TrajectoryStore.h"
+ *  @brief Bounded, time ordered buffer of states with interpolated lookup
+ *
+ *  States are kept for maxAge behind the newest one, so memory is bounded by
+ *  the publish rate. Lookups binary search the buffer and interpolate
+ *  position and velocity linearly and orientation by slerp between the two
+ *  neighbouring states. Optimized states may be added behind predicted ones,
+ *  they are inserted in time order and replace a state with the same stamp.
+ *
+ *  Stores are shared within a process through get(), keyed by the resolved
+ *  name of the estimator's pose topic.
+ */
+class TrajectoryStore
+{
+ public:
+  /**
+   * @struct State
+   * @brief Vehicle state at one time
+   */
+  struct State
+  {
+    ros::Time stamp;
+    geometry_msgs::Pose pose;   ///< Pose in the odom frame
+    geometry_msgs::Twist twist; ///< Linear velocity in the odom frame, angular velocity in the body frame
+    bool optimized;             ///< True for smoothed states, false for IMU predictions
+
+    State() : optimized(false) {}
+  };
+
+  TrajectoryStore(const ros::Duration& maxAge = ros::Duration(60.0));
+
+  void setMaxAge(const ros::Duration& maxAge);
+
+  void add(const State& state);
+
+  /**
+   * @brief Interpolate the state at stamp
+   * @param stamp time of the requested state
+   * @param state set to the interpolated state
+   * @return false if stamp is outside the stored trajectory
+   */
+  bool lookup(const ros::Time& stamp, State& state) const;
+
+  size_t size() const;
+  ros::Time oldest() const;
+  ros::Time newest() const;
+
+  /**
+   * @brief Process wide store for name, created on first use
+   */
+  static boost::shared_ptr<TrajectoryStore> get(const std::string& name);
+
+  /**
+   * @brief Interpolate between a and b, alpha 0 gives a and 1 gives b
+   */
+  static State interpolate(const State& a, const State& b, double alpha);
+
+ private:
+  mutable boost::mutex m_mutex;
+  std::deque<State> m_states; ///< Ordered by stamp
+  ros::Duration m_maxAge;
+};
+
+}
+
+#endif //AUTORALLY_TRAJECTORY_STORE_H_
@@ -0,0 +1,101 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file BicycleModel.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Kinematic bicycle model of an AutoRally vehicle
+ *
+ * @details Implementation of the BicycleModel class
+ ***********************************************/
+#include <algorithm>
+#include <cmath>
+
+#include <autorally_core/BicycleModel.h>
+
+namespace autorally_core
+{
+
+BicycleModel::BicycleModel(const Params& params) :
+  m_params(params)
+{}
+
+void BicycleModel::step(State& state, double steering, double throttle, double frontBrake, const double dt) const
+{
+  if(dt <= 0.0)
+  {
+    return;
+  }
+  steering = std::max(-1.0, std::min(1.0, steering));
+  throttle = std::max(-1.0, std::min(1.0, throttle));
+  frontBrake = std::max(0.0, std::min(1.0, frontBrake));
+
+  //steering servo, positive commands turn right so they are negative angles
+  double maxChange = m_params.steeringRate*dt;
+  double target = -steering*m_params.maxSteeringAngle;
+  state.steeringAngle += std::max(-maxChange, std::min(maxChange, target-state.steeringAngle));
+
+  //motor force falls off with speed, braking stops at zero speed
+  double acceleration = -m_params.drag*state.speed - frontBrake*m_params.maxDeceleration;
+  if(throttle >= 0.0)
+  {
+    acceleration += throttle*m_params.maxAcceleration*std::max(0.0, 1.0-state.speed/m_params.maxSpeed);
+  } else
+  {
+    acceleration += throttle*m_params.maxDeceleration;
+  }
+  double startSpeed = state.speed;
+  state.speed = std::max(0.0, state.speed+acceleration*dt);
+  double speed = (startSpeed+state.speed)/2.0;
+
+  //kinematic bicycle at the center of mass, integrated at the middle of the step
+  state.slipAngle = std::atan(m_params.rearAxleToCg/m_params.wheelbase*std::tan(state.steeringAngle));
+  state.yawRate = speed*std::cos(state.slipAngle)*std::tan(state.steeringAngle)/m_params.wheelbase;
+  double heading = state.yaw + state.yawRate*dt/2.0 + state.slipAngle;
+  state.x += speed*std::cos(heading)*dt;
+  state.y += speed*std::sin(heading)*dt;
+  state.yaw = std::atan2(std::sin(state.yaw+state.yawRate*dt), std::cos(state.yaw+state.yawRate*dt));
+
+  state.longitudinalAcceleration = (state.speed-startSpeed)/dt;
+  state.lateralAcceleration = speed*state.yawRate;
+}
+
+BicycleModel::WheelSpeeds BicycleModel::wheelSpeeds(const State& state) const
+{
+  //the rear axle moves along the heading, the front wheels along their steered direction
+  double rear = state.speed*std::cos(state.slipAngle);
+  double front = rear/std::cos(state.steeringAngle);
+  double offset = state.yawRate*m_params.track/2.0;
+
+  WheelSpeeds speeds;
+  speeds.lf = front-offset;
+  speeds.rf = front+offset;
+  speeds.lb = rear-offset;
+  speeds.rb = rear+offset;
+  return speeds;
+}
+
+}
@@ -0,0 +1,333 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file ChassisSimulator.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief ChassisSimulator class implementation
+ *
+ ***********************************************/
+#include "ChassisSimulator.h"
+
+#include <cmath>
+
+#include <pluginlib/class_list_macros.h>
+#include <rosgraph_msgs/Clock.h>
+#include <nav_msgs/Odometry.h>
+#include <sensor_msgs/Imu.h>
+#include <sensor_msgs/NavSatFix.h>
+
+#include <autorally_msgs/chassisState.h>
+#include <autorally_msgs/runstop.h>
+#include <autorally_msgs/wheelSpeeds.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_core, ChassisSimulator, autorally_core::ChassisSimulator, nodelet::Nodelet)
+
+namespace autorally_core
+{
+
+namespace
+{
+  const double EARTH_RADIUS = 6378137.0; ///< WGS84 equatorial radius in m
+  const double GRAVITY = 9.80665;        ///< m/s^2
+}
+
+ChassisSimulator::ChassisSimulator() :
+  m_alive(false),
+  m_rate(1.0),
+  m_timeStep(0.001),
+  m_duration(0.0),
+  m_startDelay(3.0)
+{}
+
+ChassisSimulator::~ChassisSimulator()
+{
+  if(m_alive)
+  {
+    m_alive = false;
+    m_thread->join();
+  }
+}
+
+void ChassisSimulator::onInit()
+{
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+
+  nhPvt.param<double>("rate", m_rate, 1.0);
+  nhPvt.param<double>("timeStep", m_timeStep, 0.001);
+  nhPvt.param<double>("duration", m_duration, 0.0);
+  nhPvt.param<double>("startDelay", m_startDelay, 3.0);
+
+  nhPvt.param<double>("commandRate", m_commandRate, 75.0);
+  nhPvt.param<double>("wheelSpeedsRate", m_wheelSpeedsRate, 70.0);
+  nhPvt.param<double>("imuRate", m_imuRate, 200.0);
+  nhPvt.param<double>("gpsRate", m_gpsRate, 10.0);
+  nhPvt.param<double>("runstopRate", m_runstopRate, 0.0);
+
+  nhPvt.param<double>("wheelSpeedNoise", m_wheelSpeedNoise, 0.05);
+  nhPvt.param<double>("gyroNoise", m_gyroNoise, 0.005);
+  nhPvt.param<double>("accelNoise", m_accelNoise, 0.05);
+  nhPvt.param<double>("gpsNoise", m_gpsNoise, 0.02);
+
+  nhPvt.param<double>("gpsOriginLatitude", m_gpsOriginLatitude, 33.7756);
+  nhPvt.param<double>("gpsOriginLongitude", m_gpsOriginLongitude, -84.3963);
+  nhPvt.param<double>("gpsOriginAltitude", m_gpsOriginAltitude, 300.0);
+  nhPvt.param<std::string>("imuFrame", m_imuFrame, "imu");
+  nhPvt.param<std::string>("gpsFrame", m_gpsFrame, "gps");
+
+  int seed;
+  nhPvt.param<int>("seed", seed, 0);
+  m_generator.seed(seed);
+
+  BicycleModel::Params params;
+  nhPvt.param<double>("vehicle/wheelbase", params.wheelbase, params.wheelbase);
+  nhPvt.param<double>("vehicle/rearAxleToCg", params.rearAxleToCg, params.rearAxleToCg);
+  nhPvt.param<double>("vehicle/track", params.track, params.track);
+  nhPvt.param<double>("vehicle/maxSteeringAngle", params.maxSteeringAngle, params.maxSteeringAngle);
+  nhPvt.param<double>("vehicle/steeringRate", params.steeringRate, params.steeringRate);
+  nhPvt.param<double>("vehicle/maxAcceleration", params.maxAcceleration, params.maxAcceleration);
+  nhPvt.param<double>("vehicle/maxSpeed", params.maxSpeed, params.maxSpeed);
+  nhPvt.param<double>("vehicle/maxDeceleration", params.maxDeceleration, params.maxDeceleration);
+  nhPvt.param<double>("vehicle/drag", params.drag, params.drag);
+  m_model = BicycleModel(params);
+
+  nhPvt.param<double>("initialX", m_state.x, 0.0);
+  nhPvt.param<double>("initialY", m_state.y, 0.0);
+  nhPvt.param<double>("initialYaw", m_state.yaw, 0.0);
+
+  if(m_timeStep <= 0.0)
+  {
+    NODELET_ERROR("ChassisSimulator: timeStep must be positive");
+    return;
+  }
+  if(!ros::Time::isSimTime())
+  {
+    NODELET_WARN("ChassisSimulator: /use_sim_time is not set, nodelets will not follow the simulator clock");
+  }
+  if(!m_arbiter.init(nh, nhPvt, getName()))
+  {
+    NODELET_ERROR_STREAM(getName() << " could not get commandMaxAge and runstopMaxAge");
+  }
+
+  m_clockPub = nh.advertise<rosgraph_msgs::Clock>("/clock", 1);
+  m_chassisStatePub = nh.advertise<autorally_msgs::chassisState>("chassisState", 1);
+  m_wheelSpeedsPub = nh.advertise<autorally_msgs::wheelSpeeds>("wheelSpeeds", 1);
+  m_imuPub = nh.advertise<sensor_msgs::Imu>("imu/imu", 10);
+  m_gpsPub = nh.advertise<sensor_msgs::NavSatFix>("gpsRoverStatus", 5);
+  m_groundTruthPub = nh.advertise<nav_msgs::Odometry>("ground_truth/state", 10);
+  if(m_runstopRate > 0.0)
+  {
+    m_runstopPub = nh.advertise<autorally_msgs::runstop>("/runstop", 5);
+  }
+
+  m_alive = true;
+  m_thread.reset(new boost::thread(boost::bind(&ChassisSimulator::run, this)));
+}
+
+void ChassisSimulator::run()
+{
+  ros::WallDuration(m_startDelay).sleep();
+
+  //start at the wall clock so stamps look like those from the vehicle
+  const ros::Time simStart(ros::WallTime::now().toSec());
+  const ros::WallTime wallStart = ros::WallTime::now();
+  ros::Time simNow = simStart;
+  ros::Time nextCommand = simNow, nextWheelSpeeds = simNow, nextImu = simNow, nextGps = simNow,
+            nextRunstop = simNow;
+  autorally_msgs::chassisState command;
+  unsigned long steps = 0;
+  publishClock(simNow);
+
+  while(m_alive && ros::ok() && (m_duration <= 0.0 || (simNow-simStart).toSec() < m_duration))
+  {
+    //stands in for the runstop box, nothing else publishes /runstop in simulation
+    if(due(nextRunstop, m_runstopRate, simNow))
+    {
+      publishRunstop(simNow);
+    }
+    //the actuators hold the last arbitrated command between command periods, like the chassis
+    if(due(nextCommand, m_commandRate, simNow))
+    {
+      autorally_msgs::chassisStatePtr chassisState(new autorally_msgs::chassisState);
+      m_arbiter.arbitrate(simNow, *chassisState);
+      chassisState->throttleRelayEnabled = true;
+      chassisState->autonomousEnabled = true;
+      chassisState->header.stamp = simNow;
+      chassisState->header.frame_id = "ChassisSimulator";
+      command = *chassisState;
+      m_chassisStatePub.publish(chassisState);
+    }
+
+    m_model.step(m_state, command.steering, command.throttle, command.frontBrake, m_timeStep);
+    simNow += ros::Duration(m_timeStep);
+    ++steps;
+
+    if(m_rate > 0.0)
+    {
+      ros::WallTime target = wallStart + ros::WallDuration((simNow-simStart).toSec()/m_rate);
+      ros::WallTime now = ros::WallTime::now();
+      if(target > now)
+      {
+        (target-now).sleep();
+      }
+    }
+    publishClock(simNow);
+
+    if(due(nextWheelSpeeds, m_wheelSpeedsRate, simNow))
+    {
+      publishWheelSpeeds(simNow);
+    }
+    if(due(nextImu, m_imuRate, simNow))
+    {
+      publishImu(simNow);
+      publishGroundTruth(simNow);
+    }
+    if(due(nextGps, m_gpsRate, simNow))
+    {
+      publishGps(simNow);
+    }
+  }
+
+  double simDuration = (simNow-simStart).toSec();
+  double wallDuration = (ros::WallTime::now()-wallStart).toSec();
+  NODELET_INFO("ChassisSimulator: %lu steps, %.3f s simulated in %.3f s wall (%.2fx real time)",
+               steps, simDuration, wallDuration, (wallDuration > 0.0) ? simDuration/wallDuration : 0.0);
+  m_alive = false;
+}
+
+bool ChassisSimulator::due(ros::Time& next, const double rate, const ros::Time& now) const
+{
+  if(rate <= 0.0 || now < next)
+  {
+    return false;
+  }
+  next += ros::Duration(1.0/rate);
+  //a rate faster than the time step cannot be kept, don't build up a backlog
+  if(next < now)
+  {
+    next = now;
+  }
+  return true;
+}
+
+double ChassisSimulator::noise(const double stddev)
+{
+  return (stddev > 0.0) ? stddev*m_normal(m_generator) : 0.0;
+}
+
+void ChassisSimulator::publishClock(const ros::Time& now)
+{
+  rosgraph_msgs::ClockPtr clock(new rosgraph_msgs::Clock);
+  clock->clock = now;
+  m_clockPub.publish(clock);
+}
+
+void ChassisSimulator::publishWheelSpeeds(const ros::Time& now)
+{
+  BicycleModel::WheelSpeeds speeds = m_model.wheelSpeeds(m_state);
+
+  autorally_msgs::wheelSpeedsPtr wheelSpeeds(new autorally_msgs::wheelSpeeds);
+  wheelSpeeds->header.stamp = now;
+  wheelSpeeds->header.frame_id = "ChassisSimulator";
+  wheelSpeeds->lfSpeed = speeds.lf + noise(m_wheelSpeedNoise);
+  wheelSpeeds->rfSpeed = speeds.rf + noise(m_wheelSpeedNoise);
+  wheelSpeeds->lbSpeed = speeds.lb + noise(m_wheelSpeedNoise);
+  wheelSpeeds->rbSpeed = speeds.rb + noise(m_wheelSpeedNoise);
+  m_wheelSpeedsPub.publish(wheelSpeeds);
+}
+
+void ChassisSimulator::publishImu(const ros::Time& now)
+{
+  //body frame x forward, y left, z up, the accelerometer reads +g on z at rest
+  sensor_msgs::ImuPtr imu(new sensor_msgs::Imu);
+  imu->header.stamp = now;
+  imu->header.frame_id = m_imuFrame;
+  imu->orientation.z = std::sin(m_state.yaw/2.0);
+  imu->orientation.w = std::cos(m_state.yaw/2.0);
+  imu->orientation_covariance[0] = imu->orientation_covariance[4] = imu->orientation_covariance[8] = 1e-6;
+
+  imu->angular_velocity.x = noise(m_gyroNoise);
+  imu->angular_velocity.y = noise(m_gyroNoise);
+  imu->angular_velocity.z = m_state.yawRate + noise(m_gyroNoise);
+  imu->angular_velocity_covariance[0] = imu->angular_velocity_covariance[4] =
+                                        imu->angular_velocity_covariance[8] = m_gyroNoise*m_gyroNoise;
+
+  imu->linear_acceleration.x = m_state.longitudinalAcceleration + noise(m_accelNoise);
+  imu->linear_acceleration.y = m_state.lateralAcceleration + noise(m_accelNoise);
+  imu->linear_acceleration.z = GRAVITY + noise(m_accelNoise);
+  imu->linear_acceleration_covariance[0] = imu->linear_acceleration_covariance[4] =
+                                           imu->linear_acceleration_covariance[8] = m_accelNoise*m_accelNoise;
+  m_imuPub.publish(imu);
+}
+
+void ChassisSimulator::publishGps(const ros::Time& now)
+{
+  //local tangent plane approximation, accurate to well under a cm over a track
+  double east = m_state.x + noise(m_gpsNoise);
+  double north = m_state.y + noise(m_gpsNoise);
+  double originLatitude = m_gpsOriginLatitude*M_PI/180.0;
+
+  sensor_msgs::NavSatFixPtr fix(new sensor_msgs::NavSatFix);
+  fix->header.stamp = now;
+  fix->header.frame_id = m_gpsFrame;
+  fix->status.status = sensor_msgs::NavSatStatus::STATUS_GBAS_FIX;
+  fix->status.service = sensor_msgs::NavSatStatus::SERVICE_GPS;
+  fix->latitude = m_gpsOriginLatitude + north/EARTH_RADIUS*180.0/M_PI;
+  fix->longitude = m_gpsOriginLongitude + east/(EARTH_RADIUS*std::cos(originLatitude))*180.0/M_PI;
+  fix->altitude = m_gpsOriginAltitude + noise(m_gpsNoise);
+  fix->position_covariance[0] = fix->position_covariance[4] = fix->position_covariance[8] = m_gpsNoise*m_gpsNoise;
+  fix->position_covariance_type = sensor_msgs::NavSatFix::COVARIANCE_TYPE_DIAGONAL_KNOWN;
+  m_gpsPub.publish(fix);
+}
+
+void ChassisSimulator::publishGroundTruth(const ros::Time& now)
+{
+  nav_msgs::OdometryPtr odom(new nav_msgs::Odometry);
+  odom->header.stamp = now;
+  odom->header.frame_id = "odom";
+  odom->child_frame_id = "base_link";
+  odom->pose.pose.position.x = m_state.x;
+  odom->pose.pose.position.y = m_state.y;
+  odom->pose.pose.orientation.z = std::sin(m_state.yaw/2.0);
+  odom->pose.pose.orientation.w = std::cos(m_state.yaw/2.0);
+  //body frame velocity
+  odom->twist.twist.linear.x = m_state.speed*std::cos(m_state.slipAngle);
+  odom->twist.twist.linear.y = m_state.speed*std::sin(m_state.slipAngle);
+  odom->twist.twist.angular.z = m_state.yawRate;
+  m_groundTruthPub.publish(odom);
+}
+
+void ChassisSimulator::publishRunstop(const ros::Time& now)
+{
+  autorally_msgs::runstopPtr runstop(new autorally_msgs::runstop);
+  runstop->header.stamp = now;
+  runstop->sender = "ChassisSimulator";
+  runstop->motionEnabled = true;
+  m_runstopPub.publish(runstop);
+}
+
+}
@@ -0,0 +1,154 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file ChassisSimulator.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief ChassisSimulator class definition
+ *
+ ***********************************************/
+#ifndef CHASSIS_SIMULATOR_H_
+#define CHASSIS_SIMULATOR_H_
+
+#include <random>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <ros/ros.h>
+#include <nodelet/nodelet.h>
+
+#include <autorally_core/BicycleModel.h>
+#include <autorally_core/ChassisArbiter.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class ChassisSimulator ChassisSimulator.h
+ *  @brief Lightweight vehicle simulator speaking the chassis interfaces
+ *
+ *  Stands in for AutoRallyChassis, the IMU and the GPS rover. chassisCommand
+ *  and runstop messages are arbitrated by ChassisArbiter with the same
+ *  parameters as AutoRallyChassis, the winning commands drive a BicycleModel,
+ *  and the simulator publishes chassisState, wheelSpeeds, imu/imu,
+ *  gpsRoverStatus and the true state on ground_truth/state, each at its own
+ *  rate and with configurable Gaussian noise.
+ *
+ *  The simulator owns the clock: it advances simulated time in timeStep
+ *  increments and publishes /clock, so /use_sim_time must be set before the
+ *  manager starts. With rate > 0 the clock is paced against wall time (1.0 is
+ *  real time, 10.0 ten times faster), with rate <= 0 it runs as fast as
+ *  possible. Closed loop controllers only see the vehicle as often as they
+ *  keep up, so pick a rate they can follow. The run ends after duration
+ *  simulated seconds, or never if duration <= 0, and logs the achieved real
+ *  time factor.
+ *
+ *  Nothing else publishes /runstop in simulation, so with runstopRate > 0 the
+ *  simulator stands in for the runstop box and publishes motionEnabled = true
+ *  as ChassisSimulator. Like the commands, runstops are aged in simulated time
+ *  against commandMaxAge and runstopMaxAge, so every commander must also run
+ *  with /use_sim_time. A commander stamping with wall time sees its messages
+ *  expire, or never expire, as soon as rate is not 1.0.
+ */
+class ChassisSimulator : public nodelet::Nodelet
+{
+ public:
+  ChassisSimulator();
+  ~ChassisSimulator();
+
+  virtual void onInit();
+
+ private:
+  ChassisArbiter m_arbiter;
+  BicycleModel m_model;
+  BicycleModel::State m_state;
+
+  ros::Publisher m_clockPub;
+  ros::Publisher m_chassisStatePub;
+  ros::Publisher m_wheelSpeedsPub;
+  ros::Publisher m_imuPub;
+  ros::Publisher m_gpsPub;
+  ros::Publisher m_groundTruthPub;
+  ros::Publisher m_runstopPub;
+
+  boost::shared_ptr<boost::thread> m_thread;
+  volatile bool m_alive;
+
+  double m_rate;        ///< Simulated seconds per wall second, <= 0 is as fast as possible
+  double m_timeStep;    ///< Model step and /clock period in simulated s
+  double m_duration;    ///< Simulated seconds to run, <= 0 runs until shutdown
+  double m_startDelay;  ///< Wall time to let other nodelets subscribe before starting in s
+
+  double m_commandRate;     ///< Arbitration and chassisState rate in Hz, like AutoRallyChassis
+  double m_wheelSpeedsRate; ///< Hz
+  double m_imuRate;         ///< Hz, ground truth is published with the IMU
+  double m_gpsRate;         ///< Hz
+  double m_runstopRate;     ///< Hz, <= 0 leaves /runstop to another node
+
+  double m_wheelSpeedNoise; ///< Standard deviation of wheel speeds in m/s
+  double m_gyroNoise;       ///< Standard deviation of angular velocity in rad/s
+  double m_accelNoise;      ///< Standard deviation of linear acceleration in m/s^2
+  double m_gpsNoise;        ///< Standard deviation of GPS position in m
+
+  double m_gpsOriginLatitude;  ///< Latitude of the world origin in degrees
+  double m_gpsOriginLongitude; ///< Longitude of the world origin in degrees
+  double m_gpsOriginAltitude;  ///< Altitude of the world origin in m
+  std::string m_imuFrame;
+  std::string m_gpsFrame;
+
+  std::mt19937 m_generator;
+  std::normal_distribution<double> m_normal;
+
+  /**
+   * @brief Thread that advances the clock, the model and the sensors
+   */
+  void run();
+  void publishClock(const ros::Time& now);
+
+  /**
+   * @brief Whether a periodic output is due, and schedule the next one if it is
+   * @param next time the output is next due, advanced by one period when it is due
+   * @param rate rate of the output in Hz, <= 0 disables it
+   * @param now current simulated time
+   */
+  bool due(ros::Time& next, const double rate, const ros::Time& now) const;
+
+  /**
+   * @brief Zero mean Gaussian noise
+   */
+  double noise(const double stddev);
+
+  void publishWheelSpeeds(const ros::Time& now);
+  void publishImu(const ros::Time& now);
+  void publishGps(const ros::Time& now);
+  void publishGroundTruth(const ros::Time& now);
+  void publishRunstop(const ros::Time& now);
+};
+
+}
+#endif //CHASSIS_SIMULATOR_H_
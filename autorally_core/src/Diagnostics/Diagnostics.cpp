@@ -39,14 +39,21 @@
 #include <stdio.h>
 #include <sstream>
 
-Diagnostics::Diagnostics()
+Diagnostics::Diagnostics() :
+  m_overallLevel(diagnostic_msgs::DiagnosticStatus::OK),
+  m_pendingLevel(diagnostic_msgs::DiagnosticStatus::OK),
+  m_publishedLevel(diagnostic_msgs::DiagnosticStatus::OK),
+  m_immediate(false)
 {}
 
 Diagnostics::Diagnostics(const std::string otherInfo,
                          const std::string hardwareID,
                          const std::string hardwareLocation) :
   m_hardwareLocation(hardwareLocation),
-  m_overallLevel(diagnostic_msgs::DiagnosticStatus::OK)
+  m_overallLevel(diagnostic_msgs::DiagnosticStatus::OK),
+  m_pendingLevel(diagnostic_msgs::DiagnosticStatus::OK),
+  m_publishedLevel(diagnostic_msgs::DiagnosticStatus::OK),
+  m_immediate(false)
 {
   init(otherInfo, hardwareID, hardwareLocation);
 }
@@ -62,6 +69,8 @@ void Diagnostics::init(const std::string& otherInfo,
   ros::NodeHandle nh;
   m_hardwareLocation = hardwareLocation;
   m_overallLevel = diagnostic_msgs::DiagnosticStatus::OK;
+  m_pendingLevel = diagnostic_msgs::DiagnosticStatus::OK;
+  m_publishedLevel = diagnostic_msgs::DiagnosticStatus::OK;
   m_updater.setHardwareID(hardwareID);
   m_updater.add(otherInfo, this, &Diagnostics::diagnostics);
 
@@ -75,6 +84,11 @@ void Diagnostics::init(const std::string& otherInfo,
   m_statusTimer = nh.createTimer(ros::Duration(diagFreq),
                       &Diagnostics::diagnosticStatus, this);
 
+  //optionally publish WARN and ERROR escalations without waiting for the heartbeat
+  double immediateInterval;
+  ros::param::param<bool>("diagnosticsImmediate", m_immediate, false);
+  ros::param::param<double>("diagnosticsImmediateInterval", immediateInterval, 0.1);
+  m_immediateInterval = ros::WallDuration(immediateInterval);
 }
 
 void Diagnostics::diag(const std::string key, const std::string value, bool lock)
@@ -95,14 +109,48 @@ void Diagnostics::diag_warn(const std::string msg)
 {
   m_dataMutex.lock();
   m_diagMsgs[msg] = diagnostic_msgs::DiagnosticStatus::WARN;
+  bool publish = escalate(diagnostic_msgs::DiagnosticStatus::WARN);
   m_dataMutex.unlock();
+
+  //publish outside the lock, diagnostics() locks it to form the message
+  if(publish && ros::ok())
+  {
+    m_updater.force_update();
+  }
 }
 
 void Diagnostics::diag_error(const std::string msg)
 {
   m_dataMutex.lock();
   m_diagMsgs[msg] = diagnostic_msgs::DiagnosticStatus::ERROR;
+  bool publish = escalate(diagnostic_msgs::DiagnosticStatus::ERROR);
   m_dataMutex.unlock();
+
+  if(publish && ros::ok())
+  {
+    m_updater.force_update();
+  }
+}
+
+bool Diagnostics::escalate(const unsigned char level)
+{
+  if(level > m_pendingLevel)
+  {
+    m_pendingLevel = level;
+  }
+  //an escalation dropped by the rate limit is retried by the next message at that level
+  if(!m_immediate || level <= m_publishedLevel)
+  {
+    return false;
+  }
+
+  ros::WallTime now = ros::WallTime::now();
+  if(now - m_lastImmediate < m_immediateInterval)
+  {
+    return false;
+  }
+  m_lastImmediate = now;
+  return true;
 }
 
 void Diagnostics::diagUpdate(const ros::TimerEvent& /*time*/)
@@ -194,6 +242,8 @@ void Diagnostics::diagnostics(diagnostic_updater::DiagnosticStatusWrapper &stat)
     stat.add(mapIt->first, mapIt->second);
   }
   m_diagMsgs.clear();
+  m_publishedLevel = m_pendingLevel;
+  m_pendingLevel = diagnostic_msgs::DiagnosticStatus::OK;
 
   std::map<std::string, std::string>::iterator mapIt2;
   for(mapIt2 = m_diags.begin(); mapIt2 != m_diags.end(); ++mapIt2)
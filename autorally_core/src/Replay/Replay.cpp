@@ -0,0 +1,436 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file Replay.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Replay class implementation
+ *
+ ***********************************************/
+#include "Replay.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <pluginlib/class_list_macros.h>
+#include <rosgraph_msgs/Clock.h>
+
+#include <autorally_core/Trace.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_core, Replay, autorally_core::Replay, nodelet::Nodelet)
+
+namespace autorally_core
+{
+
+Replay::Replay() :
+  m_alive(false),
+  m_rate(1.0),
+  m_clockStep(0.001),
+  m_startDelay(3.0),
+  m_subscriberTimeout(30.0)
+{}
+
+Replay::~Replay()
+{
+  if(m_alive)
+  {
+    m_alive = false;
+    m_thread->join();
+  }
+
+  for(auto& stream : m_streams)
+  {
+    closeStream(*stream);
+  }
+  m_inputBag.close();
+  boost::mutex::scoped_lock lock(m_outputBagMutex);
+  m_outputBag.close();
+}
+
+void Replay::onInit()
+{
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+
+  nhPvt.param<double>("rate", m_rate, 1.0);
+  nhPvt.param<double>("clockStep", m_clockStep, 0.001);
+  nhPvt.param<double>("startDelay", m_startDelay, 3.0);
+  nhPvt.param<double>("subscriberTimeout", m_subscriberTimeout, 30.0);
+  nhPvt.param<std::string>("traceFile", m_traceFile, "");
+
+  if(!ros::Time::isSimTime())
+  {
+    NODELET_WARN("Replay: /use_sim_time is not set, nodelets will not follow the replay clock");
+  }
+  m_clockPub = nh.advertise<rosgraph_msgs::Clock>("/clock", 1);
+
+  //serial streams
+  std::vector<std::string> streamNames;
+  nhPvt.getParam("serialStreams", streamNames);
+  for(const auto& name : streamNames)
+  {
+    boost::shared_ptr<SerialStream> stream(new SerialStream);
+    std::string captureFile, outputFile;
+    stream->name = name;
+    if(!nhPvt.getParam(name+"/captureFile", captureFile) ||
+       !nhPvt.getParam(name+"/portLink", stream->portLink))
+    {
+      NODELET_ERROR_STREAM("Replay: could not get captureFile and portLink for " << name);
+      continue;
+    }
+    nhPvt.param<std::string>(name+"/outputFile", outputFile, "");
+
+    if(openStream(*stream, captureFile, outputFile))
+    {
+      m_streams.push_back(stream);
+    } else
+    {
+      closeStream(*stream);
+    }
+  }
+
+  //topic logs, every topic is advertised up front so subscribers are connected before playback starts
+  std::string bagFile;
+  nhPvt.param<std::string>("bagFile", bagFile, "");
+  if(!bagFile.empty())
+  {
+    std::vector<std::string> bagTopics;
+    nhPvt.getParam("bagTopics", bagTopics);
+    try
+    {
+      m_inputBag.open(bagFile, rosbag::bagmode::Read);
+      if(bagTopics.empty())
+      {
+        m_view.reset(new rosbag::View(m_inputBag));
+      } else
+      {
+        m_view.reset(new rosbag::View(m_inputBag, rosbag::TopicQuery(bagTopics)));
+      }
+
+      for(const rosbag::ConnectionInfo* c : m_view->getConnections())
+      {
+        if(m_bagPublishers.count(c->topic) || c->topic == "/clock")
+        {
+          continue;
+        }
+        ros::AdvertiseOptions opts(c->topic, 100, c->md5sum, c->datatype, c->msg_def);
+        ros::M_string::const_iterator latching = c->header->find("latching");
+        opts.latch = (latching != c->header->end() && latching->second == "1");
+        m_bagPublishers[c->topic] = nh.advertise(opts);
+      }
+      m_viewIt = m_view->begin();
+    } catch(rosbag::BagException& e)
+    {
+      NODELET_ERROR_STREAM("Replay: could not read " << bagFile << ": " << e.what());
+      m_view.reset();
+    }
+  }
+
+  //outputs
+  std::string outputBag;
+  std::vector<std::string> recordTopics;
+  nhPvt.param<std::string>("outputBag", outputBag, "");
+  nhPvt.getParam("recordTopics", recordTopics);
+  if(!outputBag.empty() && !recordTopics.empty())
+  {
+    try
+    {
+      m_outputBag.open(outputBag, rosbag::bagmode::Write);
+      for(const auto& topic : recordTopics)
+      {
+        m_recordSubscribers.push_back(nh.subscribe<topic_tools::ShapeShifter>(topic, 100,
+                                      boost::bind(&Replay::recordCallback, this, _1, topic)));
+      }
+    } catch(rosbag::BagException& e)
+    {
+      NODELET_ERROR_STREAM("Replay: could not create " << outputBag << ": " << e.what());
+    }
+  }
+
+  if(!m_traceFile.empty())
+  {
+    Trace::setEnabled(true);
+  }
+
+  m_alive = true;
+  m_thread.reset(new boost::thread(boost::bind(&Replay::run, this)));
+}
+
+bool Replay::openStream(SerialStream& stream, const std::string& captureFile, const std::string& outputFile)
+{
+  if(!stream.input.openRead(captureFile))
+  {
+    NODELET_ERROR_STREAM("Replay: could not read serial capture " << captureFile);
+    return false;
+  }
+  if(!outputFile.empty() && !stream.output.openWrite(outputFile))
+  {
+    NODELET_ERROR_STREAM("Replay: could not create " << outputFile);
+    return false;
+  }
+
+  stream.master = posix_openpt(O_RDWR | O_NOCTTY);
+  if(stream.master == -1 || grantpt(stream.master) != 0 || unlockpt(stream.master) != 0)
+  {
+    NODELET_ERROR_STREAM("Replay: could not create a pseudo terminal for " << stream.name);
+    return false;
+  }
+  std::string slaveName = ptsname(stream.master);
+
+  //raw mode so bytes pass through untouched even before the driver configures the port
+  stream.slave = open(slaveName.c_str(), O_RDWR | O_NOCTTY);
+  struct termios settings;
+  if(stream.slave == -1 || tcgetattr(stream.slave, &settings) != 0)
+  {
+    NODELET_ERROR_STREAM("Replay: could not open " << slaveName);
+    return false;
+  }
+  cfmakeraw(&settings);
+  tcsetattr(stream.slave, TCSANOW, &settings);
+  fcntl(stream.master, F_SETFL, fcntl(stream.master, F_GETFL) | O_NONBLOCK);
+
+  //only ever replace a stale link, never a real device or file
+  struct stat linkStat;
+  if(lstat(stream.portLink.c_str(), &linkStat) == 0 && S_ISLNK(linkStat.st_mode))
+  {
+    unlink(stream.portLink.c_str());
+  }
+  if(symlink(slaveName.c_str(), stream.portLink.c_str()) != 0)
+  {
+    NODELET_ERROR_STREAM("Replay: could not link " << stream.portLink << " to " << slaveName);
+    return false;
+  }
+
+  NODELET_INFO_STREAM("Replay: " << stream.name << " on " << stream.portLink);
+  return true;
+}
+
+void Replay::closeStream(SerialStream& stream)
+{
+  if(stream.master != -1)
+  {
+    close(stream.master);
+    stream.master = -1;
+    unlink(stream.portLink.c_str());
+  }
+  if(stream.slave != -1)
+  {
+    close(stream.slave);
+    stream.slave = -1;
+  }
+  stream.input.close();
+  stream.output.close();
+}
+
+void Replay::waitForSubscribers()
+{
+  //a message published before its subscriber connects is lost, so playback waits for every replayed topic
+  ros::WallTime deadline = ros::WallTime::now() + ros::WallDuration(m_subscriberTimeout);
+  std::vector<std::string> waiting;
+  while(m_alive && ros::ok())
+  {
+    waiting.clear();
+    for(const auto& pub : m_bagPublishers)
+    {
+      if(pub.second.getNumSubscribers() == 0)
+      {
+        waiting.push_back(pub.first);
+      }
+    }
+    if(waiting.empty() || ros::WallTime::now() > deadline)
+    {
+      break;
+    }
+    ros::WallDuration(0.1).sleep();
+  }
+  for(const auto& topic : waiting)
+  {
+    NODELET_WARN_STREAM("Replay: no subscriber on " << topic << " after " << m_subscriberTimeout <<
+                        " s, replaying it anyway");
+  }
+}
+
+void Replay::run()
+{
+  ros::WallDuration(m_startDelay).sleep();
+  waitForSubscribers();
+
+  for(auto& stream : m_streams)
+  {
+    stream->hasNext = stream->input.read(stream->nextStamp, stream->nextData);
+  }
+
+  const int BAG = -2;
+  ros::Time simStart, simNow;
+  ros::WallTime wallStart;
+  unsigned long delivered = 0;
+  bool started = false;
+
+  while(m_alive && ros::ok())
+  {
+    //pick the earliest pending event across all serial streams and the bag
+    int next = -1;
+    ros::Time nextTime;
+    for(size_t i = 0; i < m_streams.size(); ++i)
+    {
+      if(m_streams[i]->hasNext && (next == -1 || m_streams[i]->nextStamp < nextTime))
+      {
+        next = i;
+        nextTime = m_streams[i]->nextStamp;
+      }
+    }
+    if(m_view && m_viewIt != m_view->end() && (next == -1 || m_viewIt->getTime() < nextTime))
+    {
+      next = BAG;
+      nextTime = m_viewIt->getTime();
+    }
+    if(next == -1)
+    {
+      break;
+    }
+
+    if(!started)
+    {
+      started = true;
+      simStart = simNow = nextTime;
+      wallStart = ros::WallTime::now();
+      publishClock(simNow);
+    }
+
+    //advance the clock to the event so timers in the replayed nodelets fire on schedule
+    while(simNow < nextTime && m_alive)
+    {
+      simNow = std::min(simNow+ros::Duration(m_clockStep), nextTime);
+      if(m_rate > 0.0)
+      {
+        ros::WallTime target = wallStart + ros::WallDuration((simNow-simStart).toSec()/m_rate);
+        ros::WallTime now = ros::WallTime::now();
+        if(target > now)
+        {
+          (target-now).sleep();
+        }
+      }
+      publishClock(simNow);
+      drainOutputs(simNow);
+    }
+
+    TraceSpan span("Replay::deliver");
+    if(next == BAG)
+    {
+      const rosbag::MessageInstance& m = *m_viewIt;
+      std::map<std::string, ros::Publisher>::iterator pub = m_bagPublishers.find(m.getTopic());
+      topic_tools::ShapeShifter::ConstPtr msg = m.instantiate<topic_tools::ShapeShifter>();
+      if(pub != m_bagPublishers.end() && msg)
+      {
+        pub->second.publish(*msg);
+      }
+      ++m_viewIt;
+    } else
+    {
+      SerialStream& stream = *m_streams[next];
+      size_t written = 0;
+      while(written < stream.nextData.size() && m_alive)
+      {
+        ssize_t n = write(stream.master, stream.nextData.data()+written, stream.nextData.size()-written);
+        if(n > 0)
+        {
+          written += n;
+        } else if(n == -1 && errno != EAGAIN && errno != EINTR)
+        {
+          NODELET_ERROR_STREAM("Replay: write to " << stream.portLink << " failed");
+          break;
+        } else
+        {
+          //the driver is not keeping up, give it a moment to drain the terminal
+          ros::WallDuration(0.001).sleep();
+        }
+      }
+      stream.hasNext = stream.input.read(stream.nextStamp, stream.nextData);
+    }
+    ++delivered;
+  }
+
+  drainOutputs(simNow);
+
+  double simDuration = (simNow-simStart).toSec();
+  double wallDuration = started ? (ros::WallTime::now()-wallStart).toSec() : 0.0;
+  NODELET_INFO("Replay: delivered %lu events, %.3f s simulated in %.3f s wall (%.2fx real time)",
+               delivered, simDuration, wallDuration, (wallDuration > 0.0) ? simDuration/wallDuration : 0.0);
+
+  if(!m_traceFile.empty())
+  {
+    Trace::setEnabled(false);
+    if(!Trace::writeChromeTrace(m_traceFile))
+    {
+      NODELET_ERROR_STREAM("Replay: could not write " << m_traceFile);
+    }
+  }
+
+  boost::mutex::scoped_lock lock(m_outputBagMutex);
+  m_recordSubscribers.clear();
+  m_outputBag.close();
+  m_alive = false;
+}
+
+void Replay::publishClock(const ros::Time& now)
+{
+  rosgraph_msgs::ClockPtr clock(new rosgraph_msgs::Clock);
+  clock->clock = now;
+  m_clockPub.publish(clock);
+}
+
+void Replay::drainOutputs(const ros::Time& now)
+{
+  char data[512];
+  ssize_t received;
+  for(auto& stream : m_streams)
+  {
+    while((received = read(stream->master, data, sizeof(data))) > 0)
+    {
+      if(stream->output.isOpen())
+      {
+        stream->output.write(now, data, received);
+      }
+    }
+  }
+}
+
+void Replay::recordCallback(const topic_tools::ShapeShifter::ConstPtr& msg, const std::string& topic)
+{
+  boost::mutex::scoped_lock lock(m_outputBagMutex);
+  if(m_outputBag.isOpen())
+  {
+    m_outputBag.write(topic, ros::Time::now(), msg);
+  }
+}
+
+}
@@ -0,0 +1,155 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file Replay.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Replay class definition
+ *
+ ***********************************************/
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <ros/ros.h>
+#include <nodelet/nodelet.h>
+#include <rosbag/bag.h>
+#include <rosbag/view.h>
+#include <topic_tools/shape_shifter.h>
+
+#include <autorally_core/SerialCapture.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class Replay Replay.h
+ *  @brief Drives the onboard nodelets from recorded data under a simulated clock
+ *
+ *  Replay feeds serial capture files (see SerialCapture) and a bag of topic
+ *  logs into the nodelets in its manager, in time order, while publishing
+ *  /clock. /use_sim_time must be set before the manager starts.
+ *
+ *  Each serial stream gets a pseudo terminal whose slave is linked at
+ *  portLink, so a driver nodelet configured with that port reads the captured
+ *  bytes as if they came from hardware. Anything the driver writes back, such
+ *  as actuator commands, is saved to the stream's outputFile.
+ *
+ *  Playback starts startDelay after loading, once every replayed bag topic
+ *  has a subscriber or subscriberTimeout has passed.
+ *
+ *  Time advances in clockStep increments of simulated time. With rate > 0 the
+ *  clock is paced against wall time (1.0 is real time), with rate <= 0 it runs
+ *  as fast as possible. Topics listed in recordTopics are written to
+ *  outputBag, and if traceFile is set the pipeline is traced for the run (see
+ *  Trace). A summary with the achieved real time factor is logged at the end.
+ */
+class Replay : public nodelet::Nodelet
+{
+ public:
+  Replay();
+  ~Replay();
+
+  virtual void onInit();
+
+ private:
+  /**
+   * @struct SerialStream
+   * @brief One replayed serial device
+   */
+  struct SerialStream
+  {
+    std::string name;      ///< Name of the stream from the parameter server
+    std::string portLink;  ///< Path linked to the pseudo terminal slave
+    SerialCapture input;   ///< Captured data being replayed
+    SerialCapture output;  ///< Data written to the port by the driver
+    int master;            ///< Pseudo terminal master file descriptor
+    int slave;             ///< Held open so the master never sees a hangup
+    bool hasNext;          ///< Whether nextData holds an unsent chunk
+    ros::Time nextStamp;   ///< Capture time of nextData
+    std::string nextData;  ///< Next chunk to send
+
+    SerialStream() :
+      master(-1),
+      slave(-1),
+      hasNext(false)
+    {}
+  };
+
+  std::vector<boost::shared_ptr<SerialStream> > m_streams;
+
+  rosbag::Bag m_inputBag; ///< Topic logs to replay
+  boost::shared_ptr<rosbag::View> m_view;
+  rosbag::View::iterator m_viewIt;
+  std::map<std::string, ros::Publisher> m_bagPublishers; ///< Publisher for each replayed topic
+
+  boost::mutex m_outputBagMutex;
+  rosbag::Bag m_outputBag; ///< Recorded output topics
+  std::vector<ros::Subscriber> m_recordSubscribers;
+
+  ros::Publisher m_clockPub;
+  boost::shared_ptr<boost::thread> m_thread;
+  volatile bool m_alive;
+
+  double m_rate;       ///< Simulated seconds per wall second, <= 0 is as fast as possible
+  double m_clockStep;  ///< Simulated time between /clock messages in s
+  double m_startDelay; ///< Wall time to let drivers open their ports before starting in s
+  double m_subscriberTimeout; ///< Wall time to wait for every replayed topic to have a subscriber in s
+  std::string m_traceFile;
+
+  /**
+   * @brief Create the pseudo terminal and open the capture files for a stream
+   */
+  bool openStream(SerialStream& stream, const std::string& captureFile, const std::string& outputFile);
+  void closeStream(SerialStream& stream);
+
+  /**
+   * @brief Thread that advances the clock and delivers recorded data
+   */
+  void run();
+
+  /**
+   * @brief Block until every replayed bag topic has a subscriber or subscriberTimeout passes
+   */
+  void waitForSubscribers();
+  void publishClock(const ros::Time& now);
+
+  /**
+   * @brief Save anything the drivers wrote to their ports
+   */
+  void drainOutputs(const ros::Time& now);
+
+  void recordCallback(const topic_tools::ShapeShifter::ConstPtr& msg, const std::string& topic);
+};
+
+}
+#endif //REPLAY_H_
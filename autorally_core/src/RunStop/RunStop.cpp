@@ -32,116 +32,138 @@
  *
  * @details Contains RunStop class implementation
  ***********************************************/
+#include <algorithm>
 #include <sstream>
+
+#include <boost/bind.hpp>
+
+#include <pluginlib/class_list_macros.h>
+
+#include <autorally_core/Trace.h>
+
 #include "RunStop.h"
 
-int main(int argc, char **argv)
+PLUGINLIB_DECLARE_CLASS(autorally_core, RunStop, autorally_core::RunStop, nodelet::Nodelet)
+
+namespace autorally_core
 {
-	ros::init(argc, argv, "RunStop");
-	ros::NodeHandle nh;
-
-	std::string runStopPort;
-	if(!nh.getParam("runStop/port", runStopPort))
-	{
-		ROS_ERROR("Could not get all RunStop parameters");
-		return -1;
-	}
-
-	RunStop runStop(nh, runStopPort);
-	
-	ros::spin();
-	return 0;
-}
 
-RunStop::RunStop(ros::NodeHandle &nh,
-                 const std::string& port):
-                 state_("RED")
+RunStop::RunStop():
+  decoder_(runStopBoxKeys),
+  state_(RunStopBoxData::RED),
+  lastLatency_(0.0),
+  maxLatency_(0.0)
+{}
+
+void RunStop::onInit()
 {
-  lastMessageTime_ = ros::Time::now() + ros::Duration(5.0);
-  
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+
+  std::string port;
   double runstopRate = 5.0;
-  if(!nh.getParam("runStop/runstopRate", runstopRate))
-	{
-		ROS_ERROR("Could not get all RunStop parameters");
-	}
+  if(!nhPvt.getParam("port", port) ||
+     !nhPvt.getParam("runstopRate", runstopRate))
+  {
+    NODELET_ERROR("Could not get all RunStop parameters");
+  }
 
-	runstopPub_ = nh.advertise<autorally_msgs::runstop>("runstop", 1);
+  lastMessageTime_ = ros::Time::now() + ros::Duration(5.0);
+  runstopData_.header.frame_id="RUNSTOP";
+  runstopData_.sender = "RUNSTOP";
+  runstopData_.motionEnabled = false;
 
-  serialPort_.init(nh, ros::this_node::getName(), "","RunStop", port, true);
-  //publish runsto pat 10Hz into system
-	doWorkTimer_ = nh.createTimer(ros::Rate(runstopRate),
+  runstopPub_ = nh.advertise<autorally_msgs::runstop>("runstop", 1);
+
+  serialPort_.registerDataCallback(boost::bind(&RunStop::runstopDataCallback, this));
+  serialPort_.init(nhPvt, getName(), "", "RunStop", port, true);
+  //republish runstop at runstopRate into system as a heartbeat
+  doWorkTimer_ = nh.createTimer(ros::Rate(runstopRate),
                                 &RunStop::doWorkTimerCallback,
                                 this);
-  
-
-  runstopData_.header.frame_id="RUNSTOP";
-  runstopData_.sender = "RUNSTOP";
 }
 
 RunStop::~RunStop()
-{}
+{
+  serialPort_.clearDataCallback();
+}
 
-//leftfront, rightfront, leftback, rightback, servo, camera
-bool RunStop::processData()
+void RunStop::runstopDataCallback()
 {
-  //frame data, and parse if an entire message is waiting
-  int startPosition = serialPort_.m_data.find("#");
-  if(startPosition > 0)
+  //time the bytes came off the port, the start of the latency measurement
+  ros::Time received = ros::Time::now();
+  TraceSpan span("RunStop::runstopDataCallback");
+
+  bool haveMessage = false;
+  RunStopBoxData data;
+  data.state = RunStopBoxData::RED;
+  size_t offset = 0;
+  unsigned int found;
+  serialPort_.lock();
+  while(decoder_.next(serialPort_.m_data, offset, data, found))
   {
-    serialPort_.m_data.erase(0, startPosition);
+    //a frame without a valid state stops motion
+    if(!(found & RunStopBoxData::STATE))
+    {
+      data.state = RunStopBoxData::RED;
+    }
+    haveMessage = true;
   }
-  startPosition = serialPort_.m_data.find("#");
+  serialPort_.m_data.erase(0, offset);
+  serialPort_.unlock();
+  State state = data.state;
 
-  size_t endPosition = serialPort_.m_data.find("\r\n");
-  //std::cout << startPosition << " " << endPosition << std::endl;
-  if(startPosition == 0 && endPosition!=std::string::npos)
+  if(!haveMessage)
   {
-    lastMessageTime_ = ros::Time::now();
-    std::string message = serialPort_.m_data.substr(0,endPosition);
-
-    //std::cout << "message:" << message.c_str() << std::endl;
-    int statusStart = message.find(":");
-    state_ = message.substr(statusStart+1,std::string::npos);
+    return;
+  }
 
-    serialPort_.m_data.erase(0, endPosition+1);
-    return true;
-  } else
+  boost::mutex::scoped_lock lock(stateMutex_);
+  lastMessageTime_ = received;
+  if(state != state_ || (state == RunStopBoxData::GREEN) != runstopData_.motionEnabled)
   {
-    if(startPosition > 0)
-    {
-      serialPort_.m_data.erase(0, startPosition);
-    }
-    return false;
+    state_ = state;
+    publish(received);
+    lastLatency_ = (ros::Time::now()-received).toSec()*1000.0;
+    maxLatency_ = std::max(maxLatency_, lastLatency_);
   }
 }
 
-void RunStop::doWorkTimerCallback(const ros::TimerEvent& /*time*/)
+void RunStop::publish(const ros::Time& stamp)
 {
-  //get out all the messages
- 	while(processData())
- 	{
- 	  //std::cout << "." << std::endl;
- 	}
-
-  runstopData_.header.stamp = ros::Time::now();
-  if(state_ == "GREEN")
-  {
-    runstopData_.motionEnabled = true;
-  } else if(state_ == "YELLOW")
-  {
-    runstopData_.motionEnabled = false;
-  } else
+  runstopData_.header.stamp = stamp;
+  runstopData_.motionEnabled = (state_ == RunStopBoxData::GREEN);
+
+  //if no recent message, runstop is false
+  if( ros::Time::now()-lastMessageTime_ > ros::Duration(1.0))
   {
     runstopData_.motionEnabled = false;
   }
 
-  //if no recent message, runstop is false
- 	if( ros::Time::now()-lastMessageTime_ > ros::Duration(1.0))
- 	{
- 	  serialPort_.diag_error("No recent data from runstop box");
- 	  runstopData_.motionEnabled = false;
- 	}
-
   runstopPub_.publish(runstopData_);
- 	serialPort_.tick("runstop Status");
+}
+
+void RunStop::doWorkTimerCallback(const ros::TimerEvent& /*time*/)
+{
+  //the decoder counts in the serial thread, copy its stats before taking stateMutex_
+  serialPort_.lock();
+  AsciiDecoderStats stats = decoder_.stats();
+  serialPort_.unlock();
+
+  boost::mutex::scoped_lock lock(stateMutex_);
+  if( ros::Time::now()-lastMessageTime_ > ros::Duration(1.0))
+  {
+    serialPort_.diag_error("No recent data from runstop box");
+  }
+  publish(ros::Time::now());
+
+  serialPort_.diag("State", (state_ == RunStopBoxData::GREEN) ? "GREEN" :
+                            ((state_ == RunStopBoxData::YELLOW) ? "YELLOW" : "RED"));
+  serialPort_.diag("Bad frames", std::to_string(stats.badFrames));
+  serialPort_.diag("Bad records", std::to_string(stats.badRecords+stats.unknownKeys));
+  serialPort_.diag("State change publish latency (ms)", std::to_string(lastLatency_));
+  serialPort_.diag("Max state change publish latency (ms)", std::to_string(maxLatency_));
+  serialPort_.tick("runstop Status");
+}
+
 }
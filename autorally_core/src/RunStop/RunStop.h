@@ -35,9 +35,13 @@
 #ifndef RUN_STOP
 #define RUN_STOP
 
+#include <boost/thread/mutex.hpp>
+
 #include <ros/ros.h>
 #include <ros/time.h>
+#include <nodelet/nodelet.h>
 #include <autorally_core/SerialInterfaceThreaded.h>
+#include <autorally_core/AsciiProtocols.h>
 #include <autorally_msgs/runstop.h>
 
 #include <iostream>
@@ -45,6 +49,9 @@
 #include <string>
 #include <queue>
 
+namespace autorally_core
+{
+
 /**
  *  @class RunStop RunStop.h
  *  "RunStop/RunStop.h"
@@ -53,32 +60,33 @@
  *  Provides a runstop message based on the combined state of a 4-button run
  *  stop box. Any red or yellow button pressed will set motionEnabled to false.
  *  The green button must be pressed to set motionEnabled to true.
+ *
+ *  Messages are parsed as soon as the serial port receives them and a state
+ *  change is published immediately. The timer republishes the current state
+ *  as a heartbeat and disables motion if the box stops sending.
  */
-class RunStop
+class RunStop : public nodelet::Nodelet
 {
 
  public:
-  ros::Timer doWorkTimer_; ///<Timer to trigger data processing
-  ros::Publisher runstopPub_;  ///<Publisher for runstop message
+  typedef RunStopBoxData::State State;
 
-  /**
-   * @brief Constructor requires all configuration needed to connect to arduino
-   *        as well as runstop values to publish
-   *
-   * @param nh NodeHandle to use for setup
-   * @param port to connect to arduino
-   */
-  RunStop(ros::NodeHandle &nh,
-                const std::string& port);
+  ros::Timer doWorkTimer_; ///<Timer to trigger heartbeat publishing
+  ros::Publisher runstopPub_;  ///<Publisher for runstop message
 
+  RunStop();
   ~RunStop();
 
   /**
-   * @brief Process incoming data stream to pull out complete message strings
-   * @return bool if a complete message string was found and processed
+   * @brief Reads the configuration needed to connect to arduino, advertises
+   *        the runstop message, and starts the publish timer
    */
-  bool processData();
+  virtual void onInit();
 
+  /**
+   * @brief Callback triggered by the serial interface when data from the box is available, publishes state changes
+   */
+  void runstopDataCallback();
 
   /**
      * @brief Timer triggered callback to publish runstop
@@ -88,8 +96,20 @@ class RunStop
 
  private:
   SerialInterfaceThreaded serialPort_;
-  std::string state_; ///< Current run stop button state received from Arduino
+  AsciiDecoder<RunStopBoxData> decoder_; ///< Decoder for messages from the box, only used on the serial thread
+  boost::mutex stateMutex_; ///< Protects state shared between the serial thread and the heartbeat timer
+  State state_; ///< Current run stop button state received from Arduino
   ros::Time lastMessageTime_; ///< Time of most recent message from Arduino
   autorally_msgs::runstop runstopData_; ///< Local runstop message
+  double lastLatency_; ///< Time from receiving the most recent state change to publishing it, in ms
+  double maxLatency_; ///< Largest receive to publish time seen, in ms
+
+  /**
+   * @brief Publish the current state, stateMutex_ must be held
+   * @param stamp time to put in the message header
+   */
+  void publish(const ros::Time& stamp);
 };
+
+}
 #endif //RUN_STOP
@@ -32,7 +32,7 @@
  *
  ***********************************************/
 
-#include <math.h>
+#include <algorithm>
 
 #include <autorally_core/SafeSpeed.h>
 
@@ -40,7 +40,14 @@ namespace autorally_core
 {
 
 SafeSpeed::SafeSpeed():
-  m_vehicleSpeeds(15), //keep 15 most recent speed values
+  m_numSenders(0),
+  m_cachedSafeSpeed(-1.0),
+  m_cachedValidUntil(ros::TIME_MAX),
+  m_safeSpeedTimeout(0.0),
+  m_maxSafeSpeed(0.0),
+  m_vehicleSpeed(0.0),
+  m_vehicleSpeedCount(0),
+  m_wheelSpeedMaxAge(0.5),
   m_prevGoodThrottle(0.0),
   m_safeSpeedIsInControl(false)
 {}
@@ -50,69 +57,131 @@ SafeSpeed::~SafeSpeed()
 
 void SafeSpeed::onInit()
 {
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+  m_limitPub = nh.advertise<autorally_msgs::safeSpeed>("safeSpeed/limit", 1);
+  init(nh, nhPvt);
+  //nothing else queries the limit when loaded on its own, so expire senders here to publish the change
+  m_expireTimer = nh.createTimer(ros::Duration(EXPIRE_CHECK_PERIOD), &SafeSpeed::expireTimerCallback, this);
 }
 
-void SafeSpeed::init(ros::NodeHandle &nh)
+void SafeSpeed::init(ros::NodeHandle &nh, ros::NodeHandle &nhPvt)
 {
+  double timeout = 0.0;
+  if(!nhPvt.getParam("safeSpeed/maxSafeSpeed", m_maxSafeSpeed) ||
+     !nhPvt.getParam("safeSpeed/Timeout", timeout) )
+  {
+    ROS_ERROR("SafeSpeed: could not get all parameters");
+  }
+  m_safeSpeedTimeout = ros::Duration(timeout);
+
+  double wheelSpeedMaxAge;
+  nhPvt.param("safeSpeed/wheelSpeedMaxAge", wheelSpeedMaxAge, 0.5);
+  m_wheelSpeedMaxAge = ros::Duration(wheelSpeedMaxAge);
+
   m_safeSpeedSub = nh.subscribe("safeSpeed", 5,
                                 &SafeSpeed::safeSpeedCallback,
                                 this);
   m_speedSub = nh.subscribe("wheelSpeeds", 5,
                             &SafeSpeed::wheelSpeedsCallback,
                             this);
-  if(!nh.getParam("safeSpeed/maxSafeSpeed", m_maxSafeSpeed) ||
-     !nh.getParam("safeSpeed/Timeout", m_safeSpeedTimeout) )
+}
+
+void SafeSpeed::safeSpeedCallback(
+  const autorally_msgs::safeSpeedConstPtr& msg)
+{
+  boost::mutex::scoped_lock lock(m_safeSpeedMutex);
+
+  //find the slot for this sender, claim a new one on the first message
+  int slot = 0;
+  while(slot < m_numSenders && m_safeSpeeds[slot].sender != msg->sender)
   {
-    ROS_ERROR("SafeSpeed: could not get all parameters");
+    ++slot;
+  }
+  if(slot == m_numSenders)
+  {
+    if(m_numSenders == MAX_SENDERS)
+    {
+      ROS_ERROR_STREAM_THROTTLE(5, "SafeSpeed: too many senders, ignoring " << msg->sender);
+      return;
+    }
+    m_safeSpeeds[slot].sender = msg->sender;
+    ++m_numSenders;
   }
+  m_safeSpeeds[slot].time = msg->header.stamp;
+  m_safeSpeeds[slot].safeSpeed = msg->speed;
 
-  loadThrottleCalibration(nh);
+  updateSafeSpeed(ros::Time::now());
+  publishLimit(msg->header.stamp);
 }
 
-void SafeSpeed::safeSpeedCallback(
-  const autorally_msgs::safeSpeedConstPtr& msg)
+void SafeSpeed::publishLimit(const ros::Time& stamp)
 {
-  //update SafeSpeed from sender, and timstamp assosiated with it
-  std::map<std::string, SafeSpeedData>::iterator newSafeSpeed;
-  if( (newSafeSpeed = m_safeSpeeds.find(msg->sender)) != m_safeSpeeds.end())
+  if(m_limitPub)
   {
-    newSafeSpeed->second.time = msg->header.stamp;
-    newSafeSpeed->second.safeSpeed = msg->speed;
-  } else
-  { //if there is not yet an entry to sender, add it
-    SafeSpeedData toAdd;
-    toAdd.time = msg->header.stamp;
-    toAdd.safeSpeed = msg->speed;
-
-    m_safeSpeeds.insert(std::pair<std::string,
-                        SafeSpeedData>(
-                        msg->sender, toAdd));
+    autorally_msgs::safeSpeedPtr limit(new autorally_msgs::safeSpeed);
+    limit->header.stamp = stamp;
+    limit->sender = "SafeSpeed";
+    limit->speed = m_cachedSafeSpeed;
+    m_limitPub.publish(limit);
   }
 }
 
-double SafeSpeed::getSafeSpeed() const
+void SafeSpeed::expireTimerCallback(const ros::TimerEvent& /*time*/)
 {
-  double safeSpeed = m_maxSafeSpeed;
-  std::map<std::string, SafeSpeedData>::const_iterator mapIt;
-  ros::Time now = ros::Time::now();
+  getSafeSpeed(ros::Time::now());
+}
+
+void SafeSpeed::updateSafeSpeed(const ros::Time& now)
+{
+  m_cachedSafeSpeed = -1.0;
+  m_cachedValidUntil = ros::TIME_MAX;
 
+  double safeSpeed = m_maxSafeSpeed;
   bool foundValidSafeSpeed = false;
-  for(mapIt = m_safeSpeeds.begin(); mapIt != m_safeSpeeds.end(); mapIt++)
+  for(int i = 0; i < m_numSenders; ++i)
   {
     //if the SafeSpeed is still considered valid
-    if( now-mapIt->second.time < ros::Duration(m_safeSpeedTimeout))
+    ros::Time expires = m_safeSpeeds[i].time + m_safeSpeedTimeout;
+    if(now < expires)
     {
-      safeSpeed = std::min(safeSpeed, mapIt->second.safeSpeed);
       foundValidSafeSpeed = true;
+      if(m_safeSpeeds[i].safeSpeed <= safeSpeed)
+      {
+        safeSpeed = m_safeSpeeds[i].safeSpeed;
+        m_cachedValidUntil = std::min(m_cachedValidUntil, expires);
+      }
     }
   }
 
-  return (foundValidSafeSpeed) ? safeSpeed : -1.0;
+  //the minimum can only rise when the sender holding it times out, so that is the only time the cache has to be
+  //rebuilt outside of a message arriving
+  if(foundValidSafeSpeed)
+  {
+    m_cachedSafeSpeed = safeSpeed;
+  }
+}
+
+double SafeSpeed::getSafeSpeed(const ros::Time& now)
+{
+  boost::mutex::scoped_lock lock(m_safeSpeedMutex);
+  if(now >= m_cachedValidUntil)
+  {
+    double previous = m_cachedSafeSpeed;
+    updateSafeSpeed(now);
+    if(m_cachedSafeSpeed != previous)
+    {
+      publishLimit(now);
+    }
+  }
+  return m_cachedSafeSpeed;
 }
 
 void SafeSpeed::setMaxSpeed(const double &maxSafeSpeed)
 {
+  boost::mutex::scoped_lock lock(m_safeSpeedMutex);
   m_maxSafeSpeed = maxSafeSpeed;
+  updateSafeSpeed(ros::Time::now());
 }
 
 double SafeSpeed::maxSpeed() const
@@ -122,23 +191,25 @@ double SafeSpeed::maxSpeed() const
 
 void SafeSpeed::wheelSpeedsCallback(const autorally_msgs::wheelSpeedsConstPtr& msg)
 {
-
-  WheelData toAdd;
-  toAdd.msg = *msg;
-  toAdd.speed = (msg->lfSpeed + msg->rfSpeed)/2.0;
-  /* Only use front wheels in case back wheels are spinning out.
-   * Since this is a fixed-size circular buffer, old measurements will be
-   * pushed out as new data arrives.
-   */
-  m_vehicleSpeeds.push_back(toAdd);
+  /* Only use front wheels in case back wheels are spinning out. */
+  boost::mutex::scoped_lock lock(m_safeSpeedMutex);
+  m_vehicleSpeed = (msg->lfSpeed + msg->rfSpeed)/2.0;
+  m_vehicleSpeedTime = msg->header.stamp;
+  if(m_vehicleSpeedCount < 2)
+  {
+    ++m_vehicleSpeedCount;
+  }
 }
 
-double SafeSpeed::safeThrottle(const double& throttleCommand)
+double SafeSpeed::safeThrottle(const double& throttleCommand, const ros::Time& now)
 {
-  double safeSpeed = getSafeSpeed();
-  if(safeSpeed <= 0.0 || m_vehicleSpeeds.size() < 2)
+  double safeSpeed = getSafeSpeed(now);
+
+  boost::mutex::scoped_lock lock(m_safeSpeedMutex);
+  //a stale wheel speed could be far below the real speed, so it is no better than none
+  if(safeSpeed <= 0.0 || m_vehicleSpeedCount < 2 || now - m_vehicleSpeedTime > m_wheelSpeedMaxAge)
   {
-    return 0.0;
+    return std::min(throttleCommand, 0.0);
   }
 
   //check if safeSpeed can give up control (if it's in control)
@@ -147,81 +218,14 @@ double SafeSpeed::safeThrottle(const double& throttleCommand)
     m_safeSpeedIsInControl = false;
   }
 
-  double safeThrottle = 0.0;
-  if(!m_safeSpeedIsInControl)
+  if(!m_safeSpeedIsInControl && m_vehicleSpeed >= safeSpeed)
   {
-    //calculate acceleration
-/*    double acceleration = 0.0;
-    double timeDiff;
-    boost::circular_buffer<WheelData>::const_iterator vecItC = m_vehicleSpeeds.begin();
-    boost::circular_buffer<WheelData>::const_iterator vecItP = vecItC++;
-    while(vecItC != m_vehicleSpeeds.end())
-    {
-      if(vecItC->msg.header.stamp != vecItP->msg.header.stamp)
-      {
-        timeDiff = (vecItC->msg.header.stamp-vecItP->msg.header.stamp).toSec();
-        acceleration += (vecItC->speed-vecItP->speed)/timeDiff;
-      }
-      vecItP = vecItC++;
-    }
-    NODELET_WARN_STREAM(" Acc:" << acceleration << " Size:" << m_vehicleSpeeds.size());
-    acceleration /= m_vehicleSpeeds.size();
-*/
-    //if all is good, let the throttle do whatever
-    //NODELET_WARN_STREAM("Speed:" << m_vehicleSpeeds.back().speed << " Acc:" << acceleration << " SafeSpeed:" << safeSpeed); 
-    if(m_vehicleSpeeds.back().speed/*+acceleration*/ < safeSpeed)
-    {
-      safeThrottle = throttleCommand;
-    } else
-    {
-      m_prevGoodThrottle = throttleCommand;
-      m_safeSpeedIsInControl = true;
-    }
-  }
-
-  if(m_safeSpeedIsInControl)
-  {
-    // cut throttle, act as a speed governer
-
-    safeThrottle = 0.0;
-    //compute safeThrottle
-    //if(!m_throttleMappings.interpolateKey(safeSpeed, safeThrottle))
-    //{
-    //  safeThrottle = 0.0;
-    //  NODELET_WARN_STREAM(
-    //            "SafeSpeed: couldn't interpolate a safeThrottle from safeSpeed:"
-    //            << safeSpeed);
-    //}
+    m_prevGoodThrottle = throttleCommand;
+    m_safeSpeedIsInControl = true;
   }
 
-  return safeThrottle;
-}
-
-void SafeSpeed::loadThrottleCalibration(ros::NodeHandle &nh)
-{
-  //ros::NodeHandle nhPvt = getPrivateNodeHandle();
-  XmlRpc::XmlRpcValue v;
-  nh.param("ServoInterface/throttleCalibration", v, v);
-  std::map<std::string, XmlRpc::XmlRpcValue>::iterator mapIt;
-  for(mapIt = v.begin(); mapIt != v.end(); mapIt++)
-  {
-    if(mapIt->second.getType() == XmlRpc::XmlRpcValue::TypeDouble)
-    {
-      std::pair<double, double> toAdd(std::pair<double, double>(
-                                      boost::lexical_cast<double>(mapIt->first),
-                                      static_cast<double>(mapIt->second)));
-      if(!m_throttleMappings.update(toAdd))
-      {
-        NODELET_ERROR_STREAM("SafeSpeed: Failed to add mapping " <<
-                             toAdd.first << ":" << toAdd.second);
-      }
-    } else
-    {
-      NODELET_ERROR("SafeSpeed: XmlRpc throttle calibration formatted incorrectly");
-    }
-  }
-  NODELET_INFO_STREAM("SafeSpeed: Loaded " << m_throttleMappings.size() <<
-                      " throttle mappings");
+  // cut throttle, act as a speed governer
+  return (m_safeSpeedIsInControl) ? std::min(throttleCommand, 0.0) : throttleCommand;
 }
 
 }
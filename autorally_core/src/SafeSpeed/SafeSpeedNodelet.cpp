@@ -1,6 +1,6 @@
 /*
 * Software License Agreement (BSD License)
-* Copyright (c) 2013, Georgia Institute of Technology
+* Copyright (c) 2026, Georgia Institute of Technology
 * All rights reserved.
 *
 * Redistribution and use in source and binary forms, with or without
@@ -24,24 +24,18 @@
 * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 /**********************************************
- * @file hpiController.cpp
- * @author Brian Goldfain <bgoldfai@gmail.com>
- * @date January 19, 2012
- * @copyright 2012 Georgia Institute of Technology
- * @brief Brief file description
- *        Brief description continued.
+ * @file SafeSpeedNodelet.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Nodelet registration for SafeSpeed
  *
- * @details Inits joystickControl
+ * @details SafeSpeed is also linked directly into AutoRallyChassis, so the
+ *          plugin is registered from its own library to keep the class from
+ *          being registered twice when both are loaded into one manager.
  ***********************************************/
-#include "JoystickControl.h"
 
-int main(int argc, char **argv)
-{
-  ros::init(argc, argv, "joystickController");
+#include <pluginlib/class_list_macros.h>
 
-  JoystickControl joystick;
+#include <autorally_core/SafeSpeed.h>
 
-  ros::spin();
-
-  return 0;
-}
+PLUGINLIB_DECLARE_CLASS(autorally_core, SafeSpeed, autorally_core::SafeSpeed, nodelet::Nodelet)
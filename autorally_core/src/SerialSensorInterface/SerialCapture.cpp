@@ -0,0 +1,113 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file SerialCapture.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief SerialCapture class implementation
+ *
+ ***********************************************/
+#include <autorally_core/SerialCapture.h>
+
+namespace
+{
+const std::string CAPTURE_MAGIC = "autorally serial capture 1\n";
+}
+
+SerialCapture::SerialCapture()
+{}
+
+SerialCapture::~SerialCapture()
+{
+  close();
+}
+
+bool SerialCapture::openWrite(const std::string& filename)
+{
+  close();
+  m_file.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!m_file.is_open())
+  {
+    return false;
+  }
+  m_file.write(CAPTURE_MAGIC.data(), CAPTURE_MAGIC.size());
+  return m_file.good();
+}
+
+bool SerialCapture::openRead(const std::string& filename)
+{
+  close();
+  m_file.open(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!m_file.is_open())
+  {
+    return false;
+  }
+
+  std::string magic(CAPTURE_MAGIC.size(), '\0');
+  m_file.read(&magic[0], magic.size());
+  if(!m_file.good() || magic != CAPTURE_MAGIC)
+  {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void SerialCapture::close()
+{
+  if(m_file.is_open())
+  {
+    m_file.close();
+  }
+}
+
+void SerialCapture::write(const ros::Time& stamp, const char* data, uint32_t length)
+{
+  uint64_t ns = stamp.toNSec();
+  m_file.write(reinterpret_cast<const char*>(&ns), sizeof(ns));
+  m_file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  m_file.write(data, length);
+  m_file.flush();
+}
+
+bool SerialCapture::read(ros::Time& stamp, std::string& data)
+{
+  uint64_t ns;
+  uint32_t length;
+  if(!m_file.read(reinterpret_cast<char*>(&ns), sizeof(ns)) ||
+     !m_file.read(reinterpret_cast<char*>(&length), sizeof(length)))
+  {
+    return false;
+  }
+
+  data.resize(length);
+  if(length > 0 && !m_file.read(&data[0], length))
+  {
+    return false;
+  }
+  stamp.fromNSec(ns);
+  return true;
+}
@@ -35,19 +35,30 @@
 
 #include <fcntl.h>
 #include <termios.h>
+#include <unistd.h>
 #include <sys/ioctl.h>
 #include <linux/usbdevice_fs.h>
 
 SerialCommon::SerialCommon() :
   m_fd(-1),
-  m_settingError("")
+  m_settingError(""),
+  m_baud(0),
+  m_stopBits(0),
+  m_dataBits(0),
+  m_hardwareFlow(false),
+  m_softwareFlow(false)
 {}
 
 SerialCommon::SerialCommon(const std::string& portHandle,
                            const std::string& hardwareID,
                            const std::string& portPath) :
   m_fd(-1),
-  m_settingError("")
+  m_settingError(""),
+  m_baud(0),
+  m_stopBits(0),
+  m_dataBits(0),
+  m_hardwareFlow(false),
+  m_softwareFlow(false)
 {
   init(portHandle, hardwareID, portPath);
 }
@@ -86,6 +97,14 @@ bool SerialCommon::connect(const std::string& port,
     return false;
   }
 
+  m_portPath = port;
+  m_baud = baud;
+  m_parity = parity;
+  m_stopBits = stopBits;
+  m_dataBits = dataBits;
+  m_hardwareFlow = hardwareFlow;
+  m_softwareFlow = softwareFlow;
+
   //m_fd = open(port.c_str(), O_WRONLY | O_NOCTTY | O_NDELAY);
   //ioctl(m_fd, USBDEVFS_RESET, 0);
 	//close(m_fd);
@@ -256,6 +275,32 @@ bool SerialCommon::connect(const std::string& port,
   return false;
 }
 
+bool SerialCommon::reconnect()
+{
+  disconnect();
+  //probe quietly while the device node is missing, connect() logs every failure to open
+  if(access(m_portPath.c_str(), R_OK | W_OK) != 0)
+  {
+    return false;
+  }
+  if(connect(m_portPath, m_baud, m_parity, m_stopBits, m_dataBits, m_hardwareFlow, m_softwareFlow))
+  {
+    return true;
+  }
+  //connect can fail after the port is opened
+  disconnect();
+  return false;
+}
+
+void SerialCommon::disconnect()
+{
+  if(m_fd != -1)
+  {
+    close(m_fd);
+    m_fd = -1;
+  }
+}
+
 int SerialCommon::writePort(const std::string data) const
 {
   int n;
@@ -32,15 +32,20 @@
  *
  ***********************************************/
 #include <autorally_core/SerialInterfaceThreaded.h>
+#include <autorally_core/Trace.h>
 
-#include <sys/select.h>
+#include <poll.h>
+#include <string.h>
+#include <errno.h>
 
 #include <ros/time.h>
 
 SerialInterfaceThreaded::SerialInterfaceThreaded() :
   m_port(""),
   m_settingsApplied(false),
-  m_alive(false)
+  m_alive(false),
+  m_reconnects(0),
+  m_lastOutageMs(0.0)
 {}
 
 SerialInterfaceThreaded::SerialInterfaceThreaded(ros::NodeHandle& nh,
@@ -51,7 +56,9 @@ SerialInterfaceThreaded::SerialInterfaceThreaded(ros::NodeHandle& nh,
   SerialCommon(portHandle, hardwareID, port),
   m_port(port),
   m_settingsApplied(false),
-  m_alive(false)
+  m_alive(false),
+  m_reconnects(0),
+  m_lastOutageMs(0.0)
 {
   init(nh, ros::this_node::getName(), portHandle, hardwareID, port, queueData);
 }
@@ -110,6 +117,18 @@ void SerialInterfaceThreaded::init(ros::NodeHandle& nh,
     ROS_ERROR("Could not get all SerialInterfaceThreaded parameters for %s", portName.c_str());
   }
 
+  std::string captureFile;
+  if(nh.getParam(newP+"/captureFile", captureFile) && !captureFile.empty())
+  {
+    if(m_capture.openWrite(captureFile))
+    {
+      ROS_INFO("Capturing %s to %s", m_port.c_str(), captureFile.c_str());
+    } else
+    {
+      ROS_ERROR("Could not open serial capture file %s", captureFile.c_str());
+    }
+  }
+
   m_settingsApplied = this->connect(m_port,
                               baud,
                               parity,
@@ -118,7 +137,13 @@ void SerialInterfaceThreaded::init(ros::NodeHandle& nh,
                               hardwareFlow,
                               softwareFlow);
 
-  if(queueData && m_settingsApplied)
+  if(!m_settingsApplied)
+  {
+    m_outageStart = ros::WallTime::now();
+  }
+
+  //a device that is missing at startup is retried by the read thread, bad settings are not
+  if(queueData && getSettingError().empty())
   {
     //start worker in separate thread
     m_alive = true;
@@ -129,40 +154,45 @@ void SerialInterfaceThreaded::init(ros::NodeHandle& nh,
 
 void SerialInterfaceThreaded::run()
 {
-  fd_set rfds;
-  struct timeval tv;
+  struct pollfd pfd;
   int retval;
   char data[512];
   int received;
 
-  if(!connected())
-  {
-    diag_error("Not connected, cannot start reading");
-    return;
-  }
-
   while(m_alive)
   {
-    /* Watch stdin (fd 0) to see when it has input. */
-    FD_ZERO(&rfds);
-    FD_SET(fileDescriptor(), &rfds);
+    if(!connected() && !waitForDevice())
+    {
+      break;
+    }
+
+    pfd.fd = fileDescriptor();
+    pfd.events = POLLIN;
+    pfd.revents = 0;
 
     /* Wait up to one seconds. */
-    tv.tv_sec = 1;
-    tv.tv_usec = 0;
-    retval = select(fileDescriptor()+1, &rfds, NULL, NULL, &tv);
-    /* Don't rely on the value of tv now! */
+    retval = poll(&pfd, 1, 1000);
 
     if(retval == -1)
     {
-      std::cout << m_port << " select() error" << std::endl;
-      diag_error("select() error");
+      //anything but a signal (e.g. a descriptor invalidated under us) would fail every
+      //poll from here on, so treat it as a lost device and reopen with backoff
+      if(errno != EINTR)
+      {
+        deviceLost(std::string("poll error: ") + strerror(errno));
+      }
     }
     else if(retval)
     {
-      /* FD_ISSET(0, &rfds) will be true. */
-      if( (received = read(fileDescriptor(), &data, 512)) >= 0)
+      autorally_core::TraceSpan span("SerialInterfaceThreaded::run");
+      received = read(fileDescriptor(), &data, 512);
+      if(received > 0)
       {
+        if(m_capture.isOpen())
+        {
+          m_capture.write(ros::Time::now(), data, received);
+        }
+
         m_dataMutex.lock();
         m_data.append(data, received);
 
@@ -181,6 +211,12 @@ void SerialInterfaceThreaded::run()
         }
         //condition can notify (wake) other threads waiting for data
 //        m_waitCond.notify_all();
+      } else if(received == 0)
+      {
+        deviceLost("end of file");
+      } else if((errno != EAGAIN && errno != EINTR) || (pfd.revents & (POLLERR | POLLHUP | POLLNVAL)))
+      {
+        deviceLost(std::string("read error: ") + strerror(errno));
       }
     }
     else
@@ -193,6 +229,54 @@ void SerialInterfaceThreaded::run()
   std::cout << "SerialInterfaceThreaded Done Running " << fileDescriptor() << std::endl;
 }
 
+void SerialInterfaceThreaded::deviceLost(const std::string& reason)
+{
+  m_outageStart = ros::WallTime::now();
+  ROS_ERROR("%s lost (%s), reconnecting", m_port.c_str(), reason.c_str());
+  diag_error("Device lost: " + reason);
+
+  {
+    boost::unique_lock<boost::mutex> lock(m_writeMutex);
+    disconnect();
+  }
+
+  //a message cut off by the loss can not be completed by data from the reconnected device
+  m_dataMutex.lock();
+  m_data.clear();
+  m_dataMutex.unlock();
+}
+
+bool SerialInterfaceThreaded::waitForDevice()
+{
+  int delayMs = RECONNECT_MIN_DELAY_MS;
+  while(m_alive)
+  {
+    {
+      boost::unique_lock<boost::mutex> lock(m_writeMutex);
+      m_settingsApplied = reconnect();
+    }
+    if(m_settingsApplied)
+    {
+      double outageMs = (ros::WallTime::now() - m_outageStart).toSec()*1000.0;
+      {
+        boost::unique_lock<boost::mutex> lock(m_outageMutex);
+        m_lastOutageMs = outageMs;
+        ++m_reconnects;
+      }
+      ROS_WARN("%s reconnected after %.1f ms", m_port.c_str(), outageMs);
+      return true;
+    }
+
+    boost::this_thread::sleep(boost::posix_time::milliseconds(delayMs));
+    delayMs *= 2;
+    if(delayMs > RECONNECT_MAX_DELAY_MS)
+    {
+      delayMs = RECONNECT_MAX_DELAY_MS;
+    }
+  }
+  return false;
+}
+
 void SerialInterfaceThreaded::lock()
 {
   m_dataMutex.lock();
@@ -275,10 +359,17 @@ int SerialInterfaceThreaded::writePortTry(const unsigned char* data, unsigned in
   return -1;
 }
 
+unsigned int SerialInterfaceThreaded::reconnects()
+{
+  boost::unique_lock<boost::mutex> lock(m_outageMutex);
+  return m_reconnects;
+}
+
 void SerialInterfaceThreaded::diagnosticStatus(const ros::TimerEvent& /*time*/)
 {
   //queue up a status messages
-  if(!m_settingsApplied)
+  //a device that is only missing has no setting error, "Not connected" below covers it
+  if(!m_settingsApplied && !getSettingError().empty())
   {
     diag_error("Serial port setting error: "+getSettingError());
   }
@@ -289,4 +380,17 @@ void SerialInterfaceThreaded::diagnosticStatus(const ros::TimerEvent& /*time*/)
   {
     diag_ok("Connected");
   }
+  //diagnostics are cleared after every publish, so the outage record is posted each period
+  unsigned int reconnects;
+  double lastOutageMs;
+  {
+    boost::unique_lock<boost::mutex> lock(m_outageMutex);
+    reconnects = m_reconnects;
+    lastOutageMs = m_lastOutageMs;
+  }
+  if(reconnects > 0)
+  {
+    diag("Reconnects", std::to_string(reconnects));
+    diag("Last outage ms", std::to_string(lastOutageMs));
+  }
 }
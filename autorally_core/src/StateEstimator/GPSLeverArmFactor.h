@@ -0,0 +1,88 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file GPSLeverArmFactor.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief GPSLeverArmFactor class definition
+ *
+ ***********************************************/
+
+#ifndef GPS_LEVER_ARM_FACTOR_H_
+#define GPS_LEVER_ARM_FACTOR_H_
+
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/nonlinear/NonlinearFactor.h>
+
+namespace autorally_core
+{
+  /**
+   *  @class GPSLeverArmFactor GPSLeverArmFactor.h
+   *  @brief GPS position measurement of an antenna rigidly offset from the body
+   *
+   *  The antenna position is the body pose applied to the fixed lever arm,
+   *  so the offset is handled in the measurement function instead of through
+   *  a separate antenna pose variable tied to the body by a between factor.
+   */
+  class GPSLeverArmFactor : public gtsam::NoiseModelFactor1<gtsam::Pose3>
+  {
+  public:
+    typedef boost::shared_ptr<GPSLeverArmFactor> shared_ptr;
+
+    /**
+     * @param poseKey body pose the antenna is attached to
+     * @param gpsIn measured antenna position in the navigation frame
+     * @param leverArm antenna position in the body frame
+     * @param model noise on the measured position
+     */
+    GPSLeverArmFactor(gtsam::Key poseKey, const gtsam::Point3& gpsIn, const gtsam::Point3& leverArm,
+                      const gtsam::SharedNoiseModel& model) :
+      gtsam::NoiseModelFactor1<gtsam::Pose3>(model, poseKey),
+      m_gpsIn(gpsIn),
+      m_leverArm(leverArm)
+    {}
+
+    virtual ~GPSLeverArmFactor() {}
+
+    virtual gtsam::NonlinearFactor::shared_ptr clone() const
+    {
+      return boost::static_pointer_cast<gtsam::NonlinearFactor>(
+          gtsam::NonlinearFactor::shared_ptr(new GPSLeverArmFactor(*this)));
+    }
+
+    gtsam::Vector evaluateError(const gtsam::Pose3& pose, boost::optional<gtsam::Matrix&> H = boost::none) const
+    {
+      gtsam::Vector3 error = pose.transform_from(m_leverArm, H) - m_gpsIn;
+      return error;
+    }
+
+  private:
+    gtsam::Point3 m_gpsIn;    ///< Measured antenna position
+    gtsam::Point3 m_leverArm; ///< Antenna position in the body frame
+  };
+};
+
+#endif /* GPS_LEVER_ARM_FACTOR_H_ */
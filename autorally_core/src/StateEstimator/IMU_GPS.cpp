@@ -37,6 +37,7 @@
 
 
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <sstream>
@@ -51,6 +52,8 @@
 #include <vector>
 #include "IMU_GPS.h"
 
+#include <pluginlib/class_list_macros.h>
+
 #include <gtsam/slam/BetweenFactor.h>
 #include <gtsam/slam/PriorFactor.h>
 #include <gtsam/navigation/ImuFactor.h>
@@ -64,26 +67,37 @@
 using symbol_shorthand::X;
 using symbol_shorthand::V;
 using symbol_shorthand::B;
-// Gps pose
-using symbol_shorthand::G;
+
+PLUGINLIB_DECLARE_CLASS(autorally_core, ImuGpsEstimator, autorally_core::Imu_Gps, nodelet::Nodelet)
 
 namespace autorally_core
 {
 
   Imu_Gps::Imu_Gps() :
-    Diagnostics("ImuGpsEstimator", "", ""),
-    m_nh("~"),
     m_biasKey(0),
     m_poseVelKey(0),
     m_lastImuT(0.0),
     m_lastImuTgps(0.0),
     m_imuQPrevTime(0),
+    m_biasKeyframeTime(0.0),
+    m_updateTimeTotal(0.0),
+    m_updateCount(0),
     m_gpsCounter(0),
     m_maxQSize(0),
     m_gpsOptQ(40),
     m_ImuOptQ(400),
-    m_gotFirstFix(false)
+    m_gotFirstFix(false),
+    m_fixedInitialPose(false),
+    m_staticAlignment(false),
+    m_isam(NULL),
+    m_alive(false)
+  {}
+
+  void Imu_Gps::onInit()
   {
+    Diagnostics::init("ImuGpsEstimator", "", "");
+    m_nh = getPrivateNodeHandle();
+
     double accSigma, gyroSigma;
     m_nh.param<double>("InitialYaw", m_initialYaw, 5);
     m_nh.param<double>("InitialRotationNoise", m_initialRotationNoise, 1.0);
@@ -105,6 +119,7 @@ namespace autorally_core
     m_nh.param<double>("CarYAngle",  m_carYAngle, 0);
     m_nh.param<double>("CarZAngle",  m_carZAngle, 0);
     m_nh.param<int>("GpsSkip",   m_gpsSkip, 5);
+    m_nh.param<double>("BiasKeyframePeriod", m_biasKeyframePeriod, 0.0);
     m_nh.param<double>("Gravity",   m_gravityMagnitude, 9.8);
     //Limit to about 0.9g
 //    m_nh.param<double>("MaxGPSAccel", m_accelLimit, 9.0);
@@ -112,6 +127,7 @@ namespace autorally_core
     m_nh.param<bool>("InvertY", m_inverty, false);
     m_nh.param<bool>("InvertZ", m_invertz, false);
     m_nh.param<double>("Imudt", m_imuDt, 1.0/200.0);
+    m_imuAxes = Vector3(m_invertx ? -1.0 : 1.0, m_inverty ? -1.0 : 1.0, m_invertz ? -1.0 : 1.0).asDiagonal();
 
     double gpsx, gpsy, gpsz;
     m_nh.param<double>("GPSX",  gpsx, 0);
@@ -120,10 +136,12 @@ namespace autorally_core
     m_imuPgps = Pose3(Rot3(), Point3(gpsx, gpsy, gpsz));
     m_imuPgps.print("IMU->GPS");
 
-    bool fixedInitialPose;
     double initialRoll, intialPitch, initialYaw;
 
-    m_nh.param<bool>("FixedInitialPose", fixedInitialPose, false);
+    m_nh.param<bool>("FixedInitialPose", m_fixedInitialPose, false);
+    m_nh.param<bool>("StaticAlignment", m_staticAlignment, false);
+    m_nh.param<double>("AlignmentTime", m_alignmentTime, 2.0);
+    m_nh.param<double>("AlignmentDistance", m_alignmentDistance, 3.0);
     m_nh.param<double>("initialRoll", initialRoll, 0);
     m_nh.param<double>("intialPitch", intialPitch, 0);
     m_nh.param<double>("initialYaw", initialYaw, 0);
@@ -149,6 +167,7 @@ namespace autorally_core
     << "CarYAngle " <<  m_carYAngle << "\n"
     << "CarZAngle " <<  m_carZAngle << "\n"
     << "GpsSkip " <<   m_gpsSkip << "\n"
+    << "BiasKeyframePeriod " << m_biasKeyframePeriod << "\n"
     << "Gravity " <<   m_gravityMagnitude << "\n";
 
     // Use an ENU frame
@@ -160,21 +179,11 @@ namespace autorally_core
     Vector biases((Vector(6) << 0, 0, 0, 0, 0, 0).finished());
     m_optimizedBias = imuBias::ConstantBias(biases);
     m_previousBias = imuBias::ConstantBias(biases);
-    m_imuPredictor = boost::make_shared<PreintegratedImuMeasurements>(m_preintegrationParams,m_optimizedBias);
 
     m_prevTime = ros::TIME_MIN;
     m_optimizedTime = 0;
 
-    imu_3dm_gx4::FilterOutputConstPtr ip;
-    if (!fixedInitialPose) {
-      while (!ip)
-      {
-        ROS_WARN("Waiting for valid initial pose");
-        ip = ros::topic::waitForMessage<imu_3dm_gx4::FilterOutput>("filter", m_nh, ros::Duration(15));
-      }
-      m_initialPose = *ip;
-    }
-    else {
+    if (m_fixedInitialPose) {
       ROS_WARN("Using fixed initial pose");
       Rot3 initialRotation = Rot3::Ypr(initialYaw, intialPitch, initialRoll);
       m_initialPose.orientation.w = initialRotation.quaternion()[0];
@@ -187,9 +196,6 @@ namespace autorally_core
 
     }
 
-    Rot3 initRot(Quaternion(m_initialPose.orientation.w, m_initialPose.orientation.x, m_initialPose.orientation.y, m_initialPose.orientation.z));
-//    std::cout << "Rotation yaw: " << initRot.yaw() << " pitch: " << initRot.pitch() << " roll: " << initRot.roll() << std::endl;
-
     m_bodyPSensor = Pose3(Rot3::RzRyRx(m_sensorXAngle, m_sensorYAngle, m_sensorZAngle),
     //m_bodyPSensor = Pose3(Rot3::RzRyRx(0, 0, 0),
         Point3(m_sensorX, m_sensorY, m_sensorZ));
@@ -206,6 +212,13 @@ namespace autorally_core
 //    m_imuAnglePub = m_nh.advertise<geometry_msgs::Point>("angle_imu", 1);
     m_timePub = m_nh.advertise<geometry_msgs::Point>("time_delays", 1);
 
+    // Nodelets in this manager find the trajectory by the name of the pose topic
+    double trajectoryLength;
+    m_nh.param<double>("TrajectoryLength", trajectoryLength, 60.0);
+    m_trajectory = TrajectoryStore::get(m_nh.resolveName("pose"));
+    m_trajectory->setMaxAge(ros::Duration(trajectoryLength));
+    m_poseAtTimeService = m_nh.advertiseService("pose_at_time", &Imu_Gps::PoseAtTimeCb, this);
+
 
     m_gravity << 0, 0, m_gravityMagnitude; // Define gravity
     m_omegaCoriolis << 0, 0, 0;
@@ -241,15 +254,36 @@ namespace autorally_core
      noiseModelBetweenbias_sigma = (Vector(6) << sigma_acc_bias_c, sigma_gyro_bias_c).finished();
      noiseModelBetweenbias = noiseModel::Diagonal::Sigmas((noiseModelBetweenbias_sigma));
 
-     m_gpsSub = m_nh.subscribe("gps", 300, &Imu_Gps::GpsCb, this);
-     m_imuSub = m_nh.subscribe("imu", 600, &Imu_Gps::ImuCb, this);
-
-     boost::thread optimizer(&Imu_Gps::GpsHelper,this);
+     // The optimizer thread waits for the initial pose and subscribes to gps and imu, so onInit
+     // does not block the nodelet manager
+     m_alive = true;
+     m_optimizerThread.reset(new boost::thread([this]()
+       {
+         try
+         {
+           GpsHelper();
+         } catch (boost::thread_interrupted&)
+         {
+           // Interrupted out of a blocking pop during shutdown
+         }
+       }));
 
   }
 
   Imu_Gps::~Imu_Gps()
-  {}
+  {
+    if (m_optimizerThread)
+    {
+      // The thread may be blocked on an empty queue, so it is interrupted as well as flagged
+      m_alive = false;
+      m_optimizerThread->interrupt();
+      m_optimizerThread->join();
+    }
+    // The thread subscribes, so the subscriptions are only safe to touch once it has exited
+    m_gpsSub.shutdown();
+    m_imuSub.shutdown();
+    delete m_isam;
+  }
 
   void Imu_Gps::GpsCb(sensor_msgs::NavSatFixConstPtr fix)
   {
@@ -262,37 +296,139 @@ namespace autorally_core
     return;
   }
 
+  void Imu_Gps::GetRawAccGyro(sensor_msgs::ImuConstPtr imu, Vector3 &acc, Vector3 &gyro)
+  {
+    acc = Vector3(imu->linear_acceleration.x, imu->linear_acceleration.y, imu->linear_acceleration.z);
+    gyro = Vector3(imu->angular_velocity.x, imu->angular_velocity.y, imu->angular_velocity.z);
+  }
+
   void Imu_Gps::GetAccGyro(sensor_msgs::ImuConstPtr imu, Vector3 &acc, Vector3 &gyro)
   {
-    double accx, accy, accz;
-    if (m_invertx) accx = -imu->linear_acceleration.x;
-    else accx = imu->linear_acceleration.x;
-    if (m_inverty) accy = -imu->linear_acceleration.y;
-    else accy = imu->linear_acceleration.y;
-    if (m_invertz) accz = -imu->linear_acceleration.z;
-    else accz = imu->linear_acceleration.z;
-    acc = Vector3(accx, accy, accz);
-
-    double gx, gy, gz;
-    if (m_invertx) gx = -imu->angular_velocity.x;
-    else gx = imu->angular_velocity.x;
-    if (m_inverty) gy = -imu->angular_velocity.y;
-    else gy = imu->angular_velocity.y;
-    if (m_invertz) gz = -imu->angular_velocity.z;
-    else gz = imu->angular_velocity.z;
-
-    gyro = Vector3(gx, gy, gz);
+    GetRawAccGyro(imu, acc, gyro);
+    acc = m_imuAxes * acc;
+    gyro = m_imuAxes * gyro;
+  }
+
+  sensor_msgs::NavSatFixConstPtr Imu_Gps::StaticAlignment()
+  {
+    // Roll, pitch and gyro bias from the mean of AlignmentTime s of IMU data with the vehicle at rest
+    ROS_WARN("Static alignment, keep the vehicle still for %.1f s", m_alignmentTime);
+    Vector3 accSum(0, 0, 0), gyroSum(0, 0, 0);
+    int count = 0;
+    sensor_msgs::ImuConstPtr imu = m_ImuOptQ.popBlocking();
+    double start = imu->header.stamp.toSec();
+    while (m_alive && ros::ok() && imu->header.stamp.toSec() - start < m_alignmentTime)
+    {
+      // The gyro bias is estimated in the axes the preintegration uses, the attitude from raw axes
+      Vector3 acc, gyro;
+      GetRawAccGyro(imu, acc, gyro);
+      accSum += acc;
+      gyroSum += m_imuAxes * gyro;
+      ++count;
+      imu = m_ImuOptQ.popBlocking();
+    }
+    if (count == 0)
+    {
+      return sensor_msgs::NavSatFixConstPtr();
+    }
+
+    Vector3 acc = accSum / count;
+    m_alignedGyroBias = gyroSum / count;
+    Rot3 level = staticAlignment(acc, 0, m_bodyPSensor.rotation(), m_carENUPcarNED.rotation());
+    double roll = level.roll();
+    double pitch = level.pitch();
+    if (fabs(acc.norm() - m_gravityMagnitude) > 0.1*m_gravityMagnitude)
+    {
+      ROS_WARN("Static alignment measured %f m/s^2 of gravity, was the vehicle moving?", acc.norm());
+    }
+    ROS_WARN("Static alignment roll %f pitch %f, drive forward %.1f m to set yaw", roll, pitch, m_alignmentDistance);
+
+    // Yaw from the direction of travel once the vehicle is AlignmentDistance m from the first fix
+    sensor_msgs::NavSatFixConstPtr prev;
+    LocalCartesian enu;
+    double prevE = 0, prevN = 0, prevU = 0;
+    while (m_alive && ros::ok())
+    {
+      sensor_msgs::NavSatFixConstPtr fix = m_gpsOptQ.popBlocking();
+      // Discard IMU data older than the fix so the queue does not overflow while waiting
+      while (imu->header.stamp < fix->header.stamp)
+      {
+        imu = m_ImuOptQ.popBlocking();
+      }
+      if (!prev)
+      {
+        enu.Reset(fix->latitude, fix->longitude, fix->altitude);
+        prev = fix;
+        continue;
+      }
+
+      double E, N, U;
+      enu.Forward(fix->latitude, fix->longitude, fix->altitude, E, N, U);
+      double dt = (fix->header.stamp - prev->header.stamp).toSec();
+      if (sqrt(E*E + N*N) >= m_alignmentDistance && dt > 0)
+      {
+        double yaw = atan2(N, E);
+        m_alignedOrientation = staticAlignment(acc, yaw, m_bodyPSensor.rotation(), m_carENUPcarNED.rotation());
+        m_alignedVelocity = Vector3(E - prevE, N - prevN, U - prevU) / dt;
+        m_alignedVelocitySigma = std::max(m_initialVelNoise, 2.0*m_gpsSigma/dt);
+        ROS_WARN("Static alignment yaw %f", yaw);
+        // This sample was popped to find the fix and is the first one the estimator integrates
+        m_alignedImu = imu;
+        return fix;
+      }
+      prev = fix;
+      prevE = E;
+      prevN = N;
+      prevU = U;
+    }
+    return sensor_msgs::NavSatFixConstPtr();
   }
 
   void Imu_Gps::GpsHelper()
   {
+    if (!m_fixedInitialPose && !m_staticAlignment)
+    {
+      imu_3dm_gx4::FilterOutputConstPtr ip;
+      while (!ip && m_alive && ros::ok())
+      {
+        ROS_WARN("Waiting for valid initial pose");
+        ip = ros::topic::waitForMessage<imu_3dm_gx4::FilterOutput>("filter", m_nh, ros::Duration(15));
+      }
+      if (!ip)
+      {
+        return;
+      }
+      m_initialPose = *ip;
+    }
+
+    m_gpsSub = m_nh.subscribe("gps", 300, &Imu_Gps::GpsCb, this);
+    m_imuSub = m_nh.subscribe("imu", 600, &Imu_Gps::ImuCb, this);
+
+    // With static alignment the estimator starts at the fix that set the yaw
+    sensor_msgs::NavSatFixConstPtr alignedFix;
+    if (!m_fixedInitialPose && m_staticAlignment)
+    {
+      alignedFix = StaticAlignment();
+      if (!alignedFix)
+      {
+        return;
+      }
+    }
+
     // Kick off the thread, and wait for our GPS measurements to come streaming in
-    while (ros::ok())
+    while (m_alive && ros::ok())
     {
-      sensor_msgs::NavSatFixConstPtr fix = m_gpsOptQ.popBlocking();
-      ++m_gpsCounter;
-      if (m_gpsCounter > m_gpsSkip) m_gpsCounter = 0;
-      else continue;
+      sensor_msgs::NavSatFixConstPtr fix = alignedFix;
+      alignedFix.reset();
+      if (!fix)
+      {
+        fix = m_gpsOptQ.popBlocking();
+        ++m_gpsCounter;
+        if (m_gpsCounter > m_gpsSkip) m_gpsCounter = 0;
+        else continue;
+      }
+
+      TraceSpan span("Imu_Gps::GpsHelper", Trace::id(fix->header.stamp));
 
       ros::WallTime tstart = ros::WallTime::now();
       if (!m_gotFirstFix)
@@ -303,41 +439,51 @@ namespace autorally_core
         m_enu.Reset(fix->latitude, fix->longitude, fix->altitude);
         // ROS_WARN("Reset local origin to %f %f %f", fix->latitude, fix->longitude, fix->altitude);
         // Add prior factors on pose, vel and bias
-        Rot3 initialOrientation = Rot3::Quaternion(m_initialPose.orientation.w,
-            m_initialPose.orientation.x,
-            m_initialPose.orientation.y,
-            m_initialPose.orientation.z);
-        //m_bodyPSensor.rotation() *
+        Rot3 initialOrientation;
+        Vector3 initialVel(0, 0, 0);
+        SharedDiagonal initialVelNoise = priorNoiseVel;
+        Vector biases;
+        if (!m_fixedInitialPose && m_staticAlignment)
+        {
+          initialOrientation = m_alignedOrientation;
+          initialVel = m_alignedVelocity;
+          initialVelNoise = noiseModel::Isotropic::Sigma(3, m_alignedVelocitySigma);
+          biases = (Vector(6) << 0, 0, 0, m_alignedGyroBias).finished();
+        } else
+        {
+          initialOrientation = m_bodyPSensor.rotation() *
+              Rot3::Quaternion(m_initialPose.orientation.w,
+                  m_initialPose.orientation.x,
+                  m_initialPose.orientation.y,
+                  m_initialPose.orientation.z) *
+              m_carENUPcarNED.rotation();
+          biases = (Vector(6) << 0, 0, 0, m_initialPose.bias.x,
+              -m_initialPose.bias.y, -m_initialPose.bias.z).finished();
+        }
         std::cout << "Initial orientation" << std::endl;
-        std::cout << m_bodyPSensor.rotation() * initialOrientation * m_carENUPcarNED.rotation() << std::endl;
-        Pose3 x0(m_bodyPSensor.rotation() * initialOrientation * m_carENUPcarNED.rotation(),
-            Point3(0, 0, 0)); /// We always start at the origin of m_enu
+        std::cout << initialOrientation << std::endl;
+        Pose3 x0(initialOrientation, Point3(0, 0, 0)); /// We always start at the origin of m_enu
         m_prevPose = x0;
+        m_prevVel = initialVel;
         PriorFactor<Pose3> priorPose(X(0), x0, priorNoisePose);
         newFactors.add(priorPose);
-        PriorFactor<Vector3> priorVel(V(0), Vector3(0, 0, 0), priorNoiseVel);
+        PriorFactor<Vector3> priorVel(V(0), initialVel, initialVelNoise);
         newFactors.add(priorVel);
-        Vector biases((Vector(6) << 0, 0, 0, m_initialPose.bias.x,
-            -m_initialPose.bias.y, -m_initialPose.bias.z).finished());
   //      std::cout << "Initial Biases\n" << biases << std::endl;
         m_previousBias = imuBias::ConstantBias(biases);
+        m_biasKeyframeTime = fix->header.stamp.toSec();
         PriorFactor<imuBias::ConstantBias> priorBias(B(0), imuBias::ConstantBias(biases), priorNoiseBias);
         newFactors.add(priorBias);
 
-        //Factor for imu->gps translation
-        BetweenFactor<Pose3> imuPgpsFactor(X(0), G(0), m_imuPgps,
-            noiseModel::Diagonal::Sigmas((Vector(6) << 0.001,0.001,0.001,0.03,0.03,0.03).finished()));
-        newFactors.add(imuPgpsFactor);
-
         // add prior values on pose, vel and bias
         newVariables.insert(X(0), x0);
-        newVariables.insert(V(0), Vector3(0, 0, 0));
+        newVariables.insert(V(0), initialVel);
         newVariables.insert(B(0), imuBias::ConstantBias(biases));
-        newVariables.insert(G(0), x0.compose(m_imuPgps));
 
         m_isam->update(newFactors, newVariables);
-        //Read IMU measurements up to the first GPS measurement
-        m_lastIMU = m_ImuOptQ.popBlocking();
+        //Read IMU measurements up to the first GPS measurement, starting from the one static alignment held
+        m_lastIMU = m_alignedImu ? m_alignedImu : m_ImuOptQ.popBlocking();
+        m_alignedImu.reset();
         //If we only pop one, we need some dt
         m_lastImuTgps = m_lastIMU->header.stamp.toSec() - 0.005;
         while(m_lastIMU->header.stamp.toSec() < fix->header.stamp.toSec())
@@ -371,8 +517,16 @@ namespace autorally_core
                   pre_int_data);
 
         newFactors.add(imuFactor);
-        newFactors.add(BetweenFactor<imuBias::ConstantBias>(B(m_biasKey), B(m_biasKey+1), imuBias::ConstantBias(),
-            noiseModel::Diagonal::Sigmas( sqrt(pre_int_data.deltaTij()) * noiseModelBetweenbias_sigma)));
+
+        // Bias drifts slowly, so IMU factors share a bias key until BiasKeyframePeriod has passed
+        double biasDt = fix->header.stamp.toSec() - m_biasKeyframeTime;
+        bool newBiasKey = (biasDt >= m_biasKeyframePeriod);
+        if (newBiasKey)
+        {
+          newFactors.add(BetweenFactor<imuBias::ConstantBias>(B(m_biasKey), B(m_biasKey+1), imuBias::ConstantBias(),
+              noiseModel::Diagonal::Sigmas( sqrt(biasDt) * noiseModelBetweenbias_sigma)));
+          newVariables.insert(B(m_biasKey+1), m_previousBias);
+        }
 
         // Predict forward to get an initialization for the pose and velocity
         NavState curNavState(m_prevPose, m_prevVel);
@@ -380,22 +534,48 @@ namespace autorally_core
 
         SharedDiagonal gpsNoise = noiseModel::Diagonal::Sigmas(Vector3(m_gpsSigma, m_gpsSigma, 3.0 * m_gpsSigma));
 
-        GPSFactor gpsFactor(G(m_poseVelKey+1), Point3(E, N, U), gpsNoise);
+        // The antenna offset is applied inside the factor, so no antenna pose variable is needed
+        GPSLeverArmFactor gpsFactor(X(m_poseVelKey+1), Point3(E, N, U), m_imuPgps.translation(), gpsNoise);
         newFactors.add(gpsFactor);
 
-        BetweenFactor<Pose3> imuPgpsFactor(X(m_poseVelKey+1), G(m_poseVelKey+1), m_imuPgps,
-            noiseModel::Diagonal::Sigmas((Vector(6) << 0.001,0.001,0.001,0.03,0.03,0.03).finished()));
-        newFactors.add(imuPgpsFactor);
-
         newVariables.insert(X(m_poseVelKey+1), nextNavState.pose());
         newVariables.insert(V(m_poseVelKey+1), nextNavState.v());
-        newVariables.insert(B(m_biasKey+1), m_previousBias);
-        newVariables.insert(G(m_poseVelKey+1), nextNavState.pose().compose(m_imuPgps));
 
         m_isam->update(newFactors, newVariables);
         m_prevPose = m_isam->calculateEstimate<Pose3>(X(m_poseVelKey+1));
         m_prevVel = m_isam->calculateEstimate<Vector3>(V(m_poseVelKey+1));
-        m_previousBias = m_isam->calculateEstimate<imuBias::ConstantBias>(B(m_biasKey+1));
+        if (newBiasKey)
+        {
+          m_biasKey ++;
+          m_biasKeyframeTime = fix->header.stamp.toSec();
+        }
+        m_previousBias = m_isam->calculateEstimate<imuBias::ConstantBias>(B(m_biasKey));
+
+        // The smoother does not estimate angular velocity, keep the predicted one
+        TrajectoryStore::State optimizedState;
+        m_trajectory->lookup(fix->header.stamp, optimizedState);
+        optimizedState.stamp = fix->header.stamp;
+        optimizedState.optimized = true;
+        Vector q = m_prevPose.rotation().quaternion();
+        optimizedState.pose.orientation.w = q[0];
+        optimizedState.pose.orientation.x = q[1];
+        optimizedState.pose.orientation.y = q[2];
+        optimizedState.pose.orientation.z = q[3];
+        optimizedState.pose.position.x = m_prevPose.x();
+        optimizedState.pose.position.y = m_prevPose.y();
+        optimizedState.pose.position.z = m_prevPose.z();
+        optimizedState.twist.linear.x = m_prevVel.x();
+        optimizedState.twist.linear.y = m_prevVel.y();
+        optimizedState.twist.linear.z = m_prevVel.z();
+        m_trajectory->add(optimizedState);
+        double updateTime = (ros::WallTime::now() - tstart).toSec()*1000.0;
+        m_updateTimeTotal += updateTime;
+        ++m_updateCount;
+        diag("Update time (ms)", std::to_string(updateTime));
+        // running totals so offline tools can average every update, not the published samples
+        diag("Update time total (ms)", std::to_string(m_updateTimeTotal));
+        diag("Updates", std::to_string(m_updateCount));
+        diag("Graph factors", std::to_string(m_isam->getFactorsUnsafe().size()));
         //std::cout << m_isam->marginalCovariance(X(m_poseVelKey+1)) << std::endl << std::endl;
 
         diag_ok("Still ok!");
@@ -425,7 +605,6 @@ namespace autorally_core
         m_biasAccPub.publish(ptAcc);
         m_biasGyroPub.publish(ptGyro);
 
-        m_biasKey ++;
         m_poseVelKey ++;
       }
     }
@@ -433,6 +612,9 @@ namespace autorally_core
 
   void Imu_Gps::ImuCb(sensor_msgs::ImuConstPtr imu)
   {
+    // The published pose carries the imu stamp, so that is the id of the pose
+    TraceSpan span("Imu_Gps::ImuCb");
+    span.setNextId(Trace::id(imu->header.stamp));
     double dt;
     if (m_lastImuT == 0) dt = 0.005;
     else dt = imu->header.stamp.toSec() - m_lastImuT;
@@ -452,7 +634,10 @@ namespace autorally_core
       ROS_WARN("Dropping an IMU measurement due to full queue!!");
     }
     // Each time we get an imu measurement, calculate the incremental pose from the last GTSAM pose
-    m_imuMeasurements.push_back(imu);
+    Vector3 acc, gyro;
+    GetRawAccGyro(imu, acc, gyro);
+    m_imuMeasurements.push(imu->header.stamp.toSec(), acc, gyro);
+    gyro = m_imuAxes * gyro;
     //Grab the most current optimized state
     double optimizedTime;
     NavState optimizedState;
@@ -465,42 +650,25 @@ namespace autorally_core
     }
     if (optimizedTime == 0) return;
 
-    bool newMeasurements = false;
-    int numImuDiscarded = 0;
-    Vector3 acc, gyro;
-    while (!m_imuMeasurements.empty() && (m_imuMeasurements.front()->header.stamp.toSec() < optimizedTime))
-    {
-      m_imuQPrevTime = m_imuMeasurements.front()->header.stamp.toSec();
-      m_imuMeasurements.pop_front();
-      newMeasurements = true;
-      numImuDiscarded ++;
-    }
-
-    if(newMeasurements)
+    if (m_imuMeasurements.eraseBefore(optimizedTime, m_imuQPrevTime) > 0)
     {
       //We need to reset integration and iterate through all our IMU measurements
-      m_imuPredictor->resetIntegration();
-      int numMeasurements = 0;
-      for (auto it=m_imuMeasurements.begin(); it!=m_imuMeasurements.end(); ++it)
-      {
-        double dt_temp =  (*it)->header.stamp.toSec() - m_imuQPrevTime;
-        m_imuQPrevTime = (*it)->header.stamp.toSec();
-        GetAccGyro(*it, acc, gyro);
-        m_imuPredictor->integrateMeasurement(acc, gyro, dt_temp);
-        numMeasurements++;
-//        ROS_INFO("IMU time %f, dt %f", (*it)->header.stamp.toSec(), dt_temp);
-      }
-//      ROS_INFO("Resetting Integration, %d measurements integrated, %d discarded", numMeasurements, numImuDiscarded);
+      m_imuPredictor.reset();
+      m_imuPredictor.integrate(m_imuMeasurements, 0, m_imuMeasurements.size(), m_imuQPrevTime,
+                               m_imuAxes, optimizedBias.accelerometer(), optimizedBias.gyroscope());
     }
-    else
+    else if (m_imuMeasurements.size() > 0)
     {
       //Just need to add the newest measurement, no new optimized pose
-      GetAccGyro(imu, acc, gyro);
-      m_imuPredictor->integrateMeasurement(acc, gyro, dt);//m_bodyPSensor);
-//      ROS_INFO("Integrating %f, dt %f", m_lastImuT, dt);
-
+      m_imuPredictor.integrate(m_imuMeasurements, m_imuMeasurements.size()-1, m_imuMeasurements.size(),
+                               imu->header.stamp.toSec() - dt,
+                               m_imuAxes, optimizedBias.accelerometer(), optimizedBias.gyroscope());
     }
-    NavState currentPose = m_imuPredictor->predict(optimizedState, optimizedBias);
+    Matrix3 R;
+    Vector3 p, v;
+    m_imuPredictor.predict(optimizedState.attitude().matrix(), optimizedState.position(), optimizedState.velocity(),
+                           m_preintegrationParams->n_gravity, R, p, v);
+    NavState currentPose(Rot3(R), Point3(p), v);
     nav_msgs::Odometry poseNew;
     poseNew.header.stamp = imu->header.stamp;
 
@@ -527,6 +695,12 @@ namespace autorally_core
 
     m_posePub.publish(poseNew);
 
+    TrajectoryStore::State predictedState;
+    predictedState.stamp = poseNew.header.stamp;
+    predictedState.pose = poseNew.pose.pose;
+    predictedState.twist = poseNew.twist.twist;
+    m_trajectory->add(predictedState);
+
     ros::Time after = ros::Time::now();
     geometry_msgs::Point delays;
     delays.x = imu->header.stamp.toSec();
@@ -536,6 +710,16 @@ namespace autorally_core
     return;
   }
 
+  bool Imu_Gps::PoseAtTimeCb(autorally_msgs::poseAtTime::Request& req, autorally_msgs::poseAtTime::Response& res)
+  {
+    TrajectoryStore::State state;
+    res.valid = m_trajectory->lookup(req.stamp, state);
+    res.optimized = state.optimized;
+    res.pose = state.pose;
+    res.twist = state.twist;
+    return true;
+  }
+
   void Imu_Gps::diagnosticStatus(const ros::TimerEvent& /*time*/)
   {
     //Don't do anything
@@ -543,11 +727,3 @@ namespace autorally_core
   }
 
 };
-
-int main (int argc, char** argv)
-{
-  ros::init(argc, argv, "stateEstimator");
-  //ros::NodeHandle n;
-  autorally_core::Imu_Gps wpt;
-  ros::spin();
-}
@@ -56,15 +56,22 @@
 
 #include <ros/ros.h>
 #include <ros/time.h>
+#include <nodelet/nodelet.h>
 #include <std_msgs/Float64.h>
 #include <sensor_msgs/Imu.h>
 #include <sensor_msgs/NavSatFix.h>
 
 #include "autorally_core/Diagnostics.h"
+#include "autorally_core/Trace.h"
+#include "autorally_core/TrajectoryStore.h"
 #include "BlockingQueue.h"
+#include "GPSLeverArmFactor.h"
+#include "ImuBatch.h"
+#include "StaticAlignment.h"
 
 #include <autorally_msgs/wheelSpeeds.h>
 #include <autorally_msgs/imageMask.h>
+#include <autorally_msgs/poseAtTime.h>
 #include <imu_3dm_gx4/FilterOutput.h>
 #include <nav_msgs/Odometry.h>
 #include <geometry_msgs/Point.h>
@@ -77,17 +84,23 @@ using namespace GeographicLib;
 
 namespace autorally_core
 {
-  class Imu_Gps : public Diagnostics
+  class Imu_Gps : public Diagnostics, public nodelet::Nodelet
   {
   public:
     Imu_Gps();
     ~Imu_Gps();
+
+    virtual void onInit();
+
     ros::NodeHandle m_nh;
     ros::Subscriber m_gpsSub, m_imuSub;
     ros::Publisher  m_posePub;
     ros::Publisher  m_biasAccPub, m_biasGyroPub;
 //    ros::Publisher  m_anglePub, m_imuAnglePub;
     ros::Publisher  m_timePub;
+    ros::ServiceServer m_poseAtTimeService;
+
+    boost::shared_ptr<TrajectoryStore> m_trajectory; ///< Recent optimized and predicted states
 
     ros::Time m_prevTime;
     ros::Time m_lastImuTime;
@@ -104,6 +117,10 @@ namespace autorally_core
     double m_sensorX, m_sensorY, m_sensorZ;
     double m_sensorXAngle, m_sensorYAngle, m_sensorZAngle;
     double m_carXAngle, m_carYAngle, m_carZAngle;
+    double m_biasKeyframePeriod; ///< Minimum time between bias variables in s, 0 adds one per GPS update
+    double m_biasKeyframeTime;   ///< Stamp of the GPS update that added the current bias variable
+    double m_updateTimeTotal;    ///< Sum of the optimization time of every GPS update in ms
+    unsigned long m_updateCount; ///< Number of GPS updates in m_updateTimeTotal
 
     int m_gpsSkip, m_gpsCounter;
     int m_maxQSize;
@@ -113,13 +130,14 @@ namespace autorally_core
     boost::mutex m_optimizedStateMutex;
     NavState m_optimizedState;
     double m_optimizedTime;
-    boost::shared_ptr<PreintegratedImuMeasurements> m_imuPredictor;
+    ImuBatchIntegrator m_imuPredictor; ///< Integrates IMU data since the last optimized state
     double m_imuDt;
     imuBias::ConstantBias m_optimizedBias, m_previousBias;
     sensor_msgs::ImuConstPtr m_lastIMU;
     boost::shared_ptr<PreintegrationParams> m_preintegrationParams;
 
-    std::list<sensor_msgs::ImuConstPtr> m_imuMeasurements, m_imuGrav;
+    ImuBatch m_imuMeasurements; ///< IMU data since the last optimized state
+    std::list<sensor_msgs::ImuConstPtr> m_imuGrav;
     imu_3dm_gx4::FilterOutput m_initialPose;
 
     Vector3 m_gravity;
@@ -128,9 +146,19 @@ namespace autorally_core
     Pose3 m_prevPose;
     Pose3 m_bodyPSensor, m_carENUPcarNED;
     Pose3 m_imuPgps;
+    Matrix3 m_imuAxes; ///< Maps raw IMU axes to the body frame, from the Invert params
 
     LocalCartesian m_enu;   /// Object to put lat/lon coordinates into local cartesian
     bool m_gotFirstFix;
+    bool m_fixedInitialPose;
+    bool m_staticAlignment;          ///< Initialize from IMU data at rest and GPS motion instead of the filter
+    double m_alignmentTime;          ///< Duration of IMU data averaged for static alignment in s
+    double m_alignmentDistance;      ///< Distance driven to take the initial yaw from GPS in m
+    Rot3 m_alignedOrientation;
+    Vector3 m_alignedGyroBias;
+    Vector3 m_alignedVelocity;
+    double m_alignedVelocitySigma;
+    sensor_msgs::ImuConstPtr m_alignedImu; ///< First IMU sample at or after the aligned fix, already popped
     bool m_invertx, m_inverty, m_invertz;
 
     SharedDiagonal priorNoisePose;
@@ -146,13 +174,19 @@ namespace autorally_core
 
     ISAM2 *m_isam;
 
+    boost::shared_ptr<boost::thread> m_optimizerThread; ///< Runs GpsHelper, joined on destruction
+    volatile bool m_alive; ///< Cleared to stop the optimizer thread
+
     void GpsCb(sensor_msgs::NavSatFixConstPtr fix);
     void ImuCb(sensor_msgs::ImuConstPtr imu);
     void FilterCb(imu_3dm_gx4::FilterOutputConstPtr fix);
     void GpsHelper();
+    sensor_msgs::NavSatFixConstPtr StaticAlignment();
     void diagnosticStatus(const ros::TimerEvent& time);
+    bool PoseAtTimeCb(autorally_msgs::poseAtTime::Request& req, autorally_msgs::poseAtTime::Response& res);
 
     void GetAccGyro(sensor_msgs::ImuConstPtr imu, Vector3 &acc, Vector3 &gyro);
+    void GetRawAccGyro(sensor_msgs::ImuConstPtr imu, Vector3 &acc, Vector3 &gyro);
   };
 };
 
@@ -0,0 +1,172 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file ImuBatch.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief ImuBatch and ImuBatchIntegrator class implementations
+ *
+ ***********************************************/
+
+#include "ImuBatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace autorally_core
+{
+  void ImuBatch::push(double stamp, const Eigen::Vector3d& acc, const Eigen::Vector3d& gyro)
+  {
+    t.push_back(stamp);
+    ax.push_back(acc.x());
+    ay.push_back(acc.y());
+    az.push_back(acc.z());
+    gx.push_back(gyro.x());
+    gy.push_back(gyro.y());
+    gz.push_back(gyro.z());
+  }
+
+  size_t ImuBatch::eraseBefore(double stamp, double& prevStamp)
+  {
+    size_t n = std::lower_bound(t.begin(), t.end(), stamp) - t.begin();
+    if (n == 0)
+    {
+      return 0;
+    }
+    prevStamp = t[n-1];
+    for (std::vector<double>* v : {&t, &ax, &ay, &az, &gx, &gy, &gz})
+    {
+      v->erase(v->begin(), v->begin()+n);
+    }
+    return n;
+  }
+
+  void ImuBatch::clear()
+  {
+    for (std::vector<double>* v : {&t, &ax, &ay, &az, &gx, &gy, &gz})
+    {
+      v->clear();
+    }
+  }
+
+  ImuBatchIntegrator::ImuBatchIntegrator()
+  {
+    reset();
+  }
+
+  void ImuBatchIntegrator::reset()
+  {
+    m_deltaR.setIdentity();
+    m_deltaP.setZero();
+    m_deltaV.setZero();
+    m_deltaT = 0.0;
+  }
+
+  void ImuBatchIntegrator::integrate(const ImuBatch& batch, size_t begin, size_t end, double prevStamp,
+                                     const Eigen::Matrix3d& axes, const Eigen::Vector3d& accBias,
+                                     const Eigen::Vector3d& gyroBias)
+  {
+    if (end <= begin)
+    {
+      return;
+    }
+    const size_t n = end-begin;
+    m_dt.resize(n);
+    for (int i = 0; i < 3; ++i)
+    {
+      m_a[i].resize(n);
+      m_w[i].resize(n);
+    }
+
+    // Elementwise pass: dt, axis transform and bias correction
+    const double* t = &batch.t[begin];
+    const double* ax = &batch.ax[begin];
+    const double* ay = &batch.ay[begin];
+    const double* az = &batch.az[begin];
+    const double* gx = &batch.gx[begin];
+    const double* gy = &batch.gy[begin];
+    const double* gz = &batch.gz[begin];
+    double* dt = &m_dt[0];
+    m_dt[0] = t[0] - prevStamp;
+    for (size_t k = 1; k < n; ++k)
+    {
+      dt[k] = t[k] - t[k-1];
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      const double r0 = axes(i, 0), r1 = axes(i, 1), r2 = axes(i, 2);
+      const double ba = accBias[i], bg = gyroBias[i];
+      double* a = &m_a[i][0];
+      double* w = &m_w[i][0];
+      for (size_t k = 0; k < n; ++k)
+      {
+        a[k] = r0*ax[k] + r1*ay[k] + r2*az[k] - ba;
+        w[k] = r0*gx[k] + r1*gy[k] + r2*gz[k] - bg;
+      }
+    }
+
+    // Sequential pass: each step depends on the previous rotation
+    for (size_t k = 0; k < n; ++k)
+    {
+      const double h = dt[k];
+      const Eigen::Vector3d a(m_a[0][k], m_a[1][k], m_a[2][k]);
+      const Eigen::Vector3d phi(m_w[0][k]*h, m_w[1][k]*h, m_w[2][k]*h);
+      const Eigen::Vector3d da = m_deltaR*a;
+
+      m_deltaP += m_deltaV*h + 0.5*h*h*da;
+      m_deltaV += h*da;
+
+      // Rodrigues' formula for exp(phi^)
+      Eigen::Matrix3d W;
+      W <<       0, -phi.z(),  phi.y(),
+           phi.z(),        0, -phi.x(),
+          -phi.y(),  phi.x(),        0;
+      const double theta2 = phi.squaredNorm();
+      double A, B;
+      if (theta2 < 1e-10)
+      {
+        A = 1.0 - theta2/6.0;
+        B = 0.5 - theta2/24.0;
+      } else
+      {
+        const double theta = std::sqrt(theta2);
+        A = std::sin(theta)/theta;
+        B = (1.0 - std::cos(theta))/theta2;
+      }
+      m_deltaR = m_deltaR*(Eigen::Matrix3d::Identity() + A*W + B*W*W);
+      m_deltaT += h;
+    }
+  }
+
+  void ImuBatchIntegrator::predict(const Eigen::Matrix3d& R, const Eigen::Vector3d& p, const Eigen::Vector3d& v,
+                                   const Eigen::Vector3d& gravity,
+                                   Eigen::Matrix3d& Rout, Eigen::Vector3d& pout, Eigen::Vector3d& vout) const
+  {
+    Rout = R*m_deltaR;
+    pout = p + v*m_deltaT + 0.5*gravity*m_deltaT*m_deltaT + R*m_deltaP;
+    vout = v + gravity*m_deltaT + R*m_deltaV;
+  }
+};
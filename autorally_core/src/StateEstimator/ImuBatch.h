@@ -0,0 +1,116 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file ImuBatch.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief ImuBatch and ImuBatchIntegrator class definitions
+ *
+ ***********************************************/
+
+#ifndef IMU_BATCH_H_
+#define IMU_BATCH_H_
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace autorally_core
+{
+  /**
+   *  @class ImuBatch ImuBatch.h
+   *  @brief Block of raw IMU samples stored as one array per axis
+   */
+  class ImuBatch
+  {
+  public:
+    void push(double stamp, const Eigen::Vector3d& acc, const Eigen::Vector3d& gyro);
+
+    /**
+     * @brief Remove all samples older than stamp
+     * @param prevStamp set to the stamp of the newest removed sample
+     * @return number of samples removed
+     */
+    size_t eraseBefore(double stamp, double& prevStamp);
+
+    size_t size() const {return t.size();}
+    void clear();
+
+    std::vector<double> t;          ///< Sample stamps in s
+    std::vector<double> ax, ay, az; ///< Raw accelerations in m/s^2
+    std::vector<double> gx, gy, gz; ///< Raw angular rates in rad/s
+  };
+
+  /**
+   *  @class ImuBatchIntegrator ImuBatch.h
+   *  @brief Preintegrates blocks of IMU samples for state prediction
+   *
+   *  Produces the same deltaR, deltaP, deltaV as gtsam's preintegration, but
+   *  without the covariance and bias Jacobians, so it can only be used to
+   *  predict, not to build factors. Samples are mapped to the body frame by a
+   *  precomputed axes matrix and bias corrected in one pass over the arrays
+   *  that the compiler can vectorize. The rotation recurrence is then run
+   *  sequentially on fixed size types.
+   */
+  class ImuBatchIntegrator
+  {
+  public:
+    ImuBatchIntegrator();
+
+    void reset();
+
+    /**
+     * @brief Integrate samples [begin, end) of batch
+     * @param prevStamp stamp before sample begin, used for its dt
+     * @param axes maps raw sensor axes to the body frame
+     */
+    void integrate(const ImuBatch& batch, size_t begin, size_t end, double prevStamp,
+                   const Eigen::Matrix3d& axes, const Eigen::Vector3d& accBias, const Eigen::Vector3d& gyroBias);
+
+    /**
+     * @brief Apply the integrated deltas to a navigation state
+     */
+    void predict(const Eigen::Matrix3d& R, const Eigen::Vector3d& p, const Eigen::Vector3d& v,
+                 const Eigen::Vector3d& gravity,
+                 Eigen::Matrix3d& Rout, Eigen::Vector3d& pout, Eigen::Vector3d& vout) const;
+
+    const Eigen::Matrix3d& deltaR() const {return m_deltaR;}
+    const Eigen::Vector3d& deltaP() const {return m_deltaP;}
+    const Eigen::Vector3d& deltaV() const {return m_deltaV;}
+    double deltaT() const {return m_deltaT;}
+
+  private:
+    Eigen::Matrix3d m_deltaR;
+    Eigen::Vector3d m_deltaP;
+    Eigen::Vector3d m_deltaV;
+    double m_deltaT;
+
+    std::vector<double> m_dt;           ///< Scratch arrays reused between calls
+    std::vector<double> m_a[3], m_w[3];
+  };
+};
+
+#endif /* IMU_BATCH_H_ */
@@ -0,0 +1,53 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file StaticAlignment.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Initial attitude from IMU data at rest and the GPS direction of travel
+ *
+ ***********************************************/
+
+#include "StaticAlignment.h"
+
+#include <cmath>
+
+namespace autorally_core
+{
+  gtsam::Rot3 staticAlignment(const gtsam::Vector3& rawAcc, double travelYaw,
+                              const gtsam::Rot3& bodyRSensor, const gtsam::Rot3& carENURcarNED)
+  {
+    // At rest the accelerometer measures the reaction to gravity, which points along -z in NED
+    double roll = atan2(-rawAcc.y(), -rawAcc.z());
+    double pitch = atan2(rawAcc.x(), sqrt(rawAcc.y()*rawAcc.y() + rawAcc.z()*rawAcc.z()));
+    gtsam::Rot3 level = bodyRSensor * gtsam::Rot3::Ypr(0, pitch, roll) * carENURcarNED;
+
+    // Turn about up until the vehicle x axis points along the direction of travel
+    gtsam::Matrix3 R = level.matrix();
+    double heading = atan2(R(1, 0), R(0, 0));
+    return gtsam::Rot3::Rz(travelYaw - heading) * level;
+  }
+};
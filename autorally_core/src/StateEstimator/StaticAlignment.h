@@ -0,0 +1,58 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file StaticAlignment.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Initial attitude from IMU data at rest and the GPS direction of travel
+ *
+ ***********************************************/
+
+#ifndef STATIC_ALIGNMENT_H_
+#define STATIC_ALIGNMENT_H_
+
+#include <gtsam/geometry/Rot3.h>
+
+namespace autorally_core
+{
+  /**
+   * @brief Vehicle attitude in ENU from the mean raw accelerometer reading at rest and the heading of travel
+   *
+   * The accelerometer is levelled in the IMU's own NED convention, the same frame as the attitude
+   * reported by the IMU's filter, and then mapped through the mounting rotations exactly as the
+   * filter attitude is, bodyRSensor * attitude * carENURcarNED. The result is finally rotated about
+   * up so the vehicle x axis points along the direction of travel.
+   *
+   * @param rawAcc mean accelerometer reading in the sensor axes, before any axis inversion
+   * @param travelYaw heading of travel in ENU, counter clockwise from east in rad
+   * @param bodyRSensor rotation applied on the left of the IMU attitude
+   * @param carENURcarNED rotation applied on the right of the IMU attitude
+   */
+  gtsam::Rot3 staticAlignment(const gtsam::Vector3& rawAcc, double travelYaw,
+                              const gtsam::Rot3& bodyRSensor, const gtsam::Rot3& carENURcarNED);
+};
+
+#endif /* STATIC_ALIGNMENT_H_ */
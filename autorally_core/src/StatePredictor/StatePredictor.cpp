@@ -0,0 +1,184 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file StatePredictor.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief StatePredictor class implementation
+ *
+ ***********************************************/
+#include <autorally_core/StatePredictor.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace autorally_core
+{
+
+StatePredictor::StatePredictor() :
+  m_dispatchLatency(0.02),
+  m_actuatorResponse(0.05),
+  m_accelerationWindow(0.1)
+{}
+
+void StatePredictor::init(ros::NodeHandle& nh, const std::string& poseTopic, const std::string& commander)
+{
+  bool measureLatency;
+  nh.param("latency/dispatchLatency", m_dispatchLatency, 0.02);
+  nh.param("latency/actuatorResponse", m_actuatorResponse, 0.05);
+  nh.param("latency/accelerationWindow", m_accelerationWindow, 0.1);
+  nh.param("latency/measureLatency", measureLatency, false);
+
+  m_trajectory = TrajectoryStore::get(poseTopic);
+  m_commander = commander;
+  if(measureLatency)
+  {
+    m_chassisCommandSub = nh.subscribe("/" + commander + "/chassisCommand", 5,
+                                       &StatePredictor::chassisCommandCallback, this);
+    m_chassisStateSub = nh.subscribe("/chassisState", 5, &StatePredictor::chassisStateCallback, this);
+  }
+}
+
+ros::Duration StatePredictor::latency() const
+{
+  boost::mutex::scoped_lock lock(m_mutex);
+  return ros::Duration(m_dispatchLatency + m_actuatorResponse);
+}
+
+bool StatePredictor::predict(const ros::Time& now, TrajectoryStore::State& state) const
+{
+  return predictAt(now + latency(), state);
+}
+
+bool StatePredictor::predictAt(const ros::Time& stamp, TrajectoryStore::State& state) const
+{
+  if(!m_trajectory)
+  {
+    return false;
+  }
+  ros::Time newest = m_trajectory->newest();
+  if(newest.isZero())
+  {
+    return false;
+  }
+  if(stamp <= newest)
+  {
+    return m_trajectory->lookup(stamp, state);
+  }
+
+  TrajectoryStore::State latest, previous;
+  if(!m_trajectory->lookup(newest, latest))
+  {
+    return false;
+  }
+  double acceleration = 0.0;
+  ros::Time windowStart = (newest.toSec() > m_accelerationWindow) ?
+                          newest - ros::Duration(m_accelerationWindow) : ros::Time();
+  if(m_trajectory->lookup(windowStart, previous) && newest > previous.stamp)
+  {
+    double speed = std::hypot(latest.twist.linear.x, latest.twist.linear.y);
+    double previousSpeed = std::hypot(previous.twist.linear.x, previous.twist.linear.y);
+    acceleration = (speed-previousSpeed) / (newest-previous.stamp).toSec();
+  }
+
+  state = extrapolate(latest, acceleration, (stamp-newest).toSec());
+  state.stamp = stamp;
+  return true;
+}
+
+TrajectoryStore::State StatePredictor::extrapolate(const TrajectoryStore::State& state, double acceleration,
+                                                    double dt)
+{
+  TrajectoryStore::State s = state;
+  s.optimized = false;
+  const double yawRate = state.twist.angular.z;
+  double speed = std::hypot(state.twist.linear.x, state.twist.linear.y);
+  double heading = std::atan2(state.twist.linear.y, state.twist.linear.x);
+
+  //do not extrapolate through a stop into reversing
+  if(acceleration < 0.0 && speed + acceleration*dt < 0.0)
+  {
+    acceleration = -speed/dt;
+  }
+
+  //short fixed steps are accurate enough for the latencies involved and avoid the singular closed form at yawRate 0
+  const int steps = std::max(1, static_cast<int>(std::ceil(dt/0.005)));
+  const double h = dt/steps;
+  for(int i = 0; i < steps; ++i)
+  {
+    double midSpeed = speed + 0.5*acceleration*h;
+    double midHeading = heading + 0.5*yawRate*h;
+    s.pose.position.x += midSpeed*std::cos(midHeading)*h;
+    s.pose.position.y += midSpeed*std::sin(midHeading)*h;
+    speed += acceleration*h;
+    heading += yawRate*h;
+  }
+  s.pose.position.z += state.twist.linear.z*dt;
+  s.twist.linear.x = speed*std::cos(heading);
+  s.twist.linear.y = speed*std::sin(heading);
+
+  //rotate the orientation about the vertical by the accumulated yaw
+  double halfYaw = 0.5*yawRate*dt;
+  double c = std::cos(halfYaw), sz = std::sin(halfYaw);
+  const geometry_msgs::Quaternion& q = state.pose.orientation;
+  s.pose.orientation.w = c*q.w - sz*q.z;
+  s.pose.orientation.x = c*q.x - sz*q.y;
+  s.pose.orientation.y = c*q.y + sz*q.x;
+  s.pose.orientation.z = c*q.z + sz*q.w;
+  return s;
+}
+
+void StatePredictor::chassisCommandCallback(const autorally_msgs::chassisCommandConstPtr& msg)
+{
+  if(msg->sender == m_commander)
+  {
+    boost::mutex::scoped_lock lock(m_mutex);
+    m_lastCommandStamp = msg->header.stamp;
+  }
+}
+
+void StatePredictor::chassisStateCallback(const autorally_msgs::chassisStateConstPtr& msg)
+{
+  if(msg->steeringCommander != m_commander && msg->throttleCommander != m_commander)
+  {
+    return;
+  }
+  boost::mutex::scoped_lock lock(m_mutex);
+  if(m_lastCommandStamp.isZero() || msg->header.stamp < m_lastCommandStamp)
+  {
+    return;
+  }
+  //the first state at or after a command is the one that applied it, later states would measure the
+  //time since the commander stopped, so each command gives at most one sample
+  double sample = (msg->header.stamp-m_lastCommandStamp).toSec();
+  m_lastCommandStamp = ros::Time();
+  if(sample <= MAX_DISPATCH_LATENCY)
+  {
+    m_dispatchLatency = 0.95*m_dispatchLatency + 0.05*sample;
+  }
+}
+
+}
@@ -0,0 +1,173 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TopicMonitor.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief TopicMonitor class implementation
+ *
+ ***********************************************/
+#include "TopicMonitor.h"
+
+#include <cmath>
+#include <limits>
+
+#include <pluginlib/class_list_macros.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_core, TopicMonitor, autorally_core::TopicMonitor, nodelet::Nodelet)
+
+namespace autorally_core
+{
+
+TopicMonitor::~TopicMonitor()
+{}
+
+void TopicMonitor::onInit()
+{
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+
+  std::vector<std::string> topics;
+  int windowSize;
+  double publishRate;
+  nhPvt.param<int>("windowSize", windowSize, 100);
+  nhPvt.param<double>("publishRate", publishRate, 1.0);
+  if(!nhPvt.getParam("topics", topics) || topics.empty())
+  {
+    NODELET_ERROR("TopicMonitor: no topics to monitor");
+  }
+  if(windowSize < 2)
+  {
+    NODELET_ERROR("TopicMonitor: windowSize must be at least 2, using 2");
+    windowSize = 2;
+  }
+  if(!(publishRate > 0.0))
+  {
+    NODELET_ERROR("TopicMonitor: publishRate must be positive, using 1 Hz");
+    publishRate = 1.0;
+  }
+
+  m_statusPub = nh.advertise<autorally_msgs::topicStatusArray>("topicStatus", 1);
+
+  for(const auto& topic : topics)
+  {
+    boost::shared_ptr<TopicWindow> window(new TopicWindow);
+    window->topic = topic;
+    window->samples.set_capacity(windowSize);
+
+    boost::function<void (const ros::MessageEvent<TopicStamp const>&)> callback =
+        boost::bind(&TopicMonitor::topicCallback, this, _1, window.get());
+    window->sub = nh.subscribe<TopicStamp>(topic, 10, callback, ros::VoidConstPtr(),
+                                           ros::TransportHints().tcpNoDelay());
+    m_topics.push_back(window);
+  }
+
+  m_publishTimer = nh.createTimer(ros::Duration(1.0/publishRate), &TopicMonitor::publishStatus, this);
+  NODELET_INFO("TopicMonitor: monitoring %u topics", (unsigned int)m_topics.size());
+}
+
+void TopicMonitor::topicCallback(const ros::MessageEvent<TopicStamp const>& event, TopicWindow* window)
+{
+  Sample sample;
+  sample.received = event.getReceiptTime();
+  if(event.getMessage()->hasHeader && !event.getMessage()->stamp.isZero())
+  {
+    sample.age = (sample.received - event.getMessage()->stamp).toSec();
+  } else
+  {
+    sample.age = std::numeric_limits<double>::quiet_NaN();
+  }
+
+  boost::mutex::scoped_lock lock(window->mutex);
+  window->samples.push_back(sample);
+}
+
+void TopicMonitor::publishStatus(const ros::TimerEvent& /*time*/)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  autorally_msgs::topicStatusArrayPtr status(new autorally_msgs::topicStatusArray);
+  status->header.stamp = ros::Time::now();
+  status->topics.resize(m_topics.size());
+
+  for(size_t i = 0; i < m_topics.size(); ++i)
+  {
+    TopicWindow& window = *m_topics[i];
+    autorally_msgs::topicStatus& topic = status->topics[i];
+    topic.topic = window.topic;
+    topic.rate = 0.0;
+    topic.jitter = nan;
+    topic.meanAge = nan;
+    topic.maxAge = nan;
+    topic.sinceLast = nan;
+
+    boost::mutex::scoped_lock lock(window.mutex);
+    const boost::circular_buffer<Sample>& samples = window.samples;
+    topic.count = samples.size();
+    if(samples.empty())
+    {
+      continue;
+    }
+    topic.sinceLast = (status->header.stamp - samples.back().received).toSec();
+
+    //rate and jitter from the time between consecutive messages
+    double span = (samples.back().received - samples.front().received).toSec();
+    if(samples.size() > 1 && span > 0.0)
+    {
+      double meanInterval = span/(samples.size()-1);
+      double sumSquares = 0.0;
+      for(size_t j = 1; j < samples.size(); ++j)
+      {
+        double error = (samples[j].received - samples[j-1].received).toSec() - meanInterval;
+        sumSquares += error*error;
+      }
+      topic.rate = 1.0/meanInterval;
+      topic.jitter = std::sqrt(sumSquares/(samples.size()-1));
+    }
+
+    //age is only available for topics with a header
+    double ageSum = 0.0;
+    double maxAge = -std::numeric_limits<double>::infinity();
+    unsigned int ages = 0;
+    for(size_t j = 0; j < samples.size(); ++j)
+    {
+      if(!std::isnan(samples[j].age))
+      {
+        ageSum += samples[j].age;
+        maxAge = std::max(maxAge, samples[j].age);
+        ++ages;
+      }
+    }
+    if(ages)
+    {
+      topic.meanAge = ageSum/ages;
+      topic.maxAge = maxAge;
+    }
+  }
+
+  m_statusPub.publish(status);
+}
+
+}
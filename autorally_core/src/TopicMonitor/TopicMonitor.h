@@ -0,0 +1,112 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TopicMonitor.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief TopicMonitor class definition
+ *
+ ***********************************************/
+#ifndef TOPIC_MONITOR_H_
+#define TOPIC_MONITOR_H_
+
+#include <string>
+#include <vector>
+
+#include <boost/circular_buffer.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <ros/ros.h>
+#include <nodelet/nodelet.h>
+
+#include <autorally_msgs/topicStatusArray.h>
+
+#include "TopicStamp.h"
+
+namespace autorally_core
+{
+
+/**
+ *  @class TopicMonitor TopicMonitor.h
+ *  @brief Measures rate, jitter, and age of arbitrary topics
+ *
+ *  Subscribes to each topic in the topics parameter without knowing its type
+ *  (see TopicStamp), so only the header stamp of each message is decoded. The
+ *  receive time and age (receive time - header stamp) of the last windowSize
+ *  messages of each topic are kept, and a topicStatusArray summarizing every
+ *  window is published on topicStatus at publishRate.
+ */
+class TopicMonitor : public nodelet::Nodelet
+{
+ public:
+  ~TopicMonitor();
+
+  virtual void onInit();
+
+ private:
+  /**
+   * @struct Sample
+   * @brief Timing of one received message
+   */
+  struct Sample
+  {
+    ros::Time received; ///< When the message was received
+    double age;         ///< received - header stamp in s, NaN without a header
+  };
+
+  /**
+   * @struct TopicWindow
+   * @brief The most recent samples of one monitored topic
+   */
+  struct TopicWindow
+  {
+    std::string topic;
+    ros::Subscriber sub;
+    boost::mutex mutex; ///< Guards samples, the subscriber callback and the timer may run concurrently
+    boost::circular_buffer<Sample> samples;
+  };
+
+  std::vector<boost::shared_ptr<TopicWindow> > m_topics;
+  ros::Publisher m_statusPub; ///< Publisher for the summary of all topics
+  ros::Timer m_publishTimer; ///< Timer to trigger publishing the summary
+
+  /**
+   * @brief Record the timing of a message from a monitored topic
+   * @param event the message with its receive time
+   * @param window the window of the topic the message was received on
+   */
+  void topicCallback(const ros::MessageEvent<TopicStamp const>& event, TopicWindow* window);
+
+  /**
+   * @brief Time triggered callback to publish the summary of all windows
+   * @param time information about callback firing
+   */
+  void publishStatus(const ros::TimerEvent& time);
+};
+
+}
+#endif //TOPIC_MONITOR_H_
@@ -0,0 +1,160 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TopicStamp.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief TopicStamp message type definition
+ *
+ ***********************************************/
+#ifndef TOPIC_STAMP_H_
+#define TOPIC_STAMP_H_
+
+#include <algorithm>
+#include <map>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <ros/ros.h>
+#include <ros/message_traits.h>
+#include <ros/serialization.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @struct TopicStamp TopicStamp.h
+ *  @brief Subscribes to any topic and decodes only the header stamp
+ *
+ *  Like topic_tools::ShapeShifter, the md5sum and datatype are "*" so any
+ *  publisher accepts the subscription, but instead of copying the serialized
+ *  message only the first 12 bytes (seq, stamp) are read, and only if the
+ *  publisher's message definition starts with a Header. The rest of the
+ *  payload is never touched.
+ */
+struct TopicStamp
+{
+  typedef boost::shared_ptr<TopicStamp> Ptr;
+  typedef boost::shared_ptr<TopicStamp const> ConstPtr;
+
+  bool hasHeader;  ///< Set from the connection header before the message is read
+  ros::Time stamp; ///< Header stamp, zero if the message has no header
+
+  TopicStamp() :
+    hasHeader(false)
+  {}
+
+  /**
+   * @brief Check if a message definition starts with a Header field
+   * @param definition full message definition from a connection header
+   */
+  static bool definitionHasHeader(const std::string& definition)
+  {
+    size_t lineStart = 0;
+    while(lineStart < definition.size())
+    {
+      size_t lineEnd = definition.find('\n', lineStart);
+      if(lineEnd == std::string::npos)
+      {
+        lineEnd = definition.size();
+      }
+      size_t first = definition.find_first_not_of(" \t\r", lineStart);
+      //skip blank and comment lines before the first field
+      if(first < lineEnd && definition[first] != '#')
+      {
+        size_t end = std::min(definition.find('#', first), lineEnd);
+        size_t length = definition.find_last_not_of(" \t\r", end-1) + 1 - first;
+        return (length == 13 && definition.compare(first, length, "Header header") == 0) ||
+               (length == 22 && definition.compare(first, length, "std_msgs/Header header") == 0);
+      }
+      lineStart = lineEnd+1;
+    }
+    return false;
+  }
+};
+
+}
+
+namespace ros
+{
+namespace message_traits
+{
+
+template<> struct MD5Sum<autorally_core::TopicStamp>
+{
+  static const char* value() {return "*";}
+  static const char* value(const autorally_core::TopicStamp&) {return "*";}
+};
+
+template<> struct DataType<autorally_core::TopicStamp>
+{
+  static const char* value() {return "*";}
+  static const char* value(const autorally_core::TopicStamp&) {return "*";}
+};
+
+template<> struct Definition<autorally_core::TopicStamp>
+{
+  static const char* value() {return "";}
+  static const char* value(const autorally_core::TopicStamp&) {return "";}
+};
+
+}
+
+namespace serialization
+{
+
+template<> struct Serializer<autorally_core::TopicStamp>
+{
+  template<typename Stream>
+  inline static void read(Stream& stream, autorally_core::TopicStamp& m)
+  {
+    if(m.hasHeader)
+    {
+      uint32_t seq;
+      stream.next(seq);
+      stream.next(m.stamp.sec);
+      stream.next(m.stamp.nsec);
+    }
+  }
+};
+
+template<> struct PreDeserialize<autorally_core::TopicStamp>
+{
+  static void notify(const PreDeserializeParams<autorally_core::TopicStamp>& params)
+  {
+    if(params.connection_header)
+    {
+      std::map<std::string, std::string>::const_iterator it = params.connection_header->find("message_definition");
+      params.message->hasHeader = it != params.connection_header->end() &&
+                                  autorally_core::TopicStamp::definitionHasHeader(it->second);
+    }
+  }
+};
+
+}
+}
+#endif //TOPIC_STAMP_H_
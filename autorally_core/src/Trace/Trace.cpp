@@ -0,0 +1,225 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file Trace.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Trace class implementation
+ *
+ ***********************************************/
+#include <autorally_core/Trace.h>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+namespace autorally_core
+{
+
+namespace
+{
+/**
+ * Single producer ring of events, read like a seqlock. Only the owning thread
+ * writes. head is published with release semantics after a slot is filled, and
+ * a release fence ahead of the slot stores pairs with the reader's acquire
+ * fence, so a reader that copied any part of a new event also sees the head
+ * that event was written at and can tell which slots were overwritten.
+ */
+struct ThreadBuffer
+{
+  struct Slot
+  {
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> start;
+    std::atomic<uint64_t> end;
+    std::atomic<uint64_t> id;
+    std::atomic<uint64_t> nextId;
+  };
+
+  Slot slots[Trace::BUFFER_SIZE];
+  std::atomic<uint64_t> head;
+  int tid;
+
+  ThreadBuffer() :
+    head(0),
+    tid(static_cast<int>(syscall(SYS_gettid)))
+  {}
+};
+
+std::mutex g_registryMutex;
+///< Buffers are never freed so events from exited threads can still be exported
+std::vector<ThreadBuffer*> g_buffers;
+thread_local ThreadBuffer* t_buffer = NULL;
+
+ThreadBuffer* threadBuffer()
+{
+  if(!t_buffer)
+  {
+    t_buffer = new ThreadBuffer;
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    g_buffers.push_back(t_buffer);
+  }
+  return t_buffer;
+}
+
+void appendMicroseconds(std::ostringstream& ss, uint64_t ns)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%llu.%03llu",
+           static_cast<unsigned long long>(ns/1000),
+           static_cast<unsigned long long>(ns%1000));
+  ss << buf;
+}
+}
+
+const size_t Trace::BUFFER_SIZE;
+std::atomic<bool> Trace::s_enabled(false);
+
+void Trace::setEnabled(bool enabled)
+{
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t Trace::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Trace::record(const char* name, uint64_t start, uint64_t end, uint64_t id, uint64_t nextId)
+{
+  ThreadBuffer* buffer = threadBuffer();
+  uint64_t head = buffer->head.load(std::memory_order_relaxed);
+  ThreadBuffer::Slot& slot = buffer->slots[head%BUFFER_SIZE];
+  //order the previous head store before the overwrite, a reader that sees any new field then sees head
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.start.store(start, std::memory_order_relaxed);
+  slot.end.store(end, std::memory_order_relaxed);
+  slot.id.store(id, std::memory_order_relaxed);
+  slot.nextId.store(nextId, std::memory_order_relaxed);
+  buffer->head.store(head+1, std::memory_order_release);
+}
+
+std::vector<Trace::Event> Trace::snapshot()
+{
+  std::vector<ThreadBuffer*> buffers;
+  {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    buffers = g_buffers;
+  }
+
+  std::vector<Event> events;
+  for(ThreadBuffer* buffer : buffers)
+  {
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t first = (head > BUFFER_SIZE) ? head-BUFFER_SIZE : 0;
+    size_t copied = events.size();
+    for(uint64_t i = first; i < head; ++i)
+    {
+      const ThreadBuffer::Slot& slot = buffer->slots[i%BUFFER_SIZE];
+      Event e;
+      e.name = slot.name.load(std::memory_order_relaxed);
+      e.start = slot.start.load(std::memory_order_relaxed);
+      e.end = slot.end.load(std::memory_order_relaxed);
+      e.id = slot.id.load(std::memory_order_relaxed);
+      e.nextId = slot.nextId.load(std::memory_order_relaxed);
+      e.tid = buffer->tid;
+      events.push_back(e);
+    }
+
+    //the writer may have lapped us while copying, drop every slot it could have touched, the
+    //fence pairs with the release fence in record() so newHead covers any slot we saw overwritten
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t newHead = buffer->head.load(std::memory_order_relaxed);
+    if(newHead+1 > first+BUFFER_SIZE)
+    {
+      uint64_t overwritten = std::min<uint64_t>(newHead+1-BUFFER_SIZE-first, head-first);
+      events.erase(events.begin()+copied, events.begin()+copied+overwritten);
+    }
+  }
+
+  std::sort(events.begin(), events.end(),
+            [](const Event& a, const Event& b) {return a.start < b.start;});
+  return events;
+}
+
+std::string Trace::toChromeTrace(const std::vector<Event>& events)
+{
+  int pid = static_cast<int>(getpid());
+  std::ostringstream ss;
+  bool first = true;
+
+  ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  for(const Event& e : events)
+  {
+    ss << (first ? "\n" : ",\n");
+    first = false;
+    ss << "{\"name\":\"" << e.name << "\",\"cat\":\"autorally\",\"ph\":\"X\",\"pid\":" << pid
+       << ",\"tid\":" << e.tid << ",\"ts\":";
+    appendMicroseconds(ss, e.start);
+    ss << ",\"dur\":";
+    appendMicroseconds(ss, e.end-e.start);
+    ss << ",\"args\":{\"id\":\"" << e.id << "\",\"nextId\":\"" << e.nextId << "\"}}";
+
+    //ids are written as strings, message stamps in ns do not fit in a double
+    if(e.id)
+    {
+      ss << ",\n{\"name\":\"message\",\"cat\":\"flow\",\"ph\":\"f\",\"bp\":\"e\",\"id\":\"" << e.id
+         << "\",\"pid\":" << pid << ",\"tid\":" << e.tid << ",\"ts\":";
+      appendMicroseconds(ss, e.start);
+      ss << "}";
+    }
+    if(e.nextId)
+    {
+      ss << ",\n{\"name\":\"message\",\"cat\":\"flow\",\"ph\":\"s\",\"id\":\"" << e.nextId
+         << "\",\"pid\":" << pid << ",\"tid\":" << e.tid << ",\"ts\":";
+      appendMicroseconds(ss, e.end);
+      ss << "}";
+    }
+  }
+  ss << "\n]}\n";
+  return ss.str();
+}
+
+bool Trace::writeChromeTrace(const std::string& filename)
+{
+  std::ofstream out(filename.c_str(), std::ios::out | std::ios::trunc);
+  if(!out.is_open())
+  {
+    return false;
+  }
+  out << toChromeTrace(snapshot());
+  return out.good();
+}
+
+}
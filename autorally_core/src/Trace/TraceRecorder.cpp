@@ -0,0 +1,90 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TraceRecorder.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief TraceRecorder class implementation
+ *
+ ***********************************************/
+#include "TraceRecorder.h"
+
+#include <autorally_core/Trace.h>
+#include <pluginlib/class_list_macros.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_core, TraceRecorder, autorally_core::TraceRecorder, nodelet::Nodelet)
+
+namespace autorally_core
+{
+
+TraceRecorder::~TraceRecorder()
+{
+  if(Trace::enabled())
+  {
+    Trace::setEnabled(false);
+    writeTrace();
+  }
+}
+
+void TraceRecorder::onInit()
+{
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+
+  bool enabled;
+  double writePeriod;
+  nhPvt.param<bool>("enabled", enabled, true);
+  nhPvt.param<std::string>("outputFile", m_outputFile, "/tmp/autorally_trace.json");
+  nhPvt.param<double>("writePeriod", writePeriod, 5.0);
+
+  Trace::setEnabled(enabled);
+  if(!enabled)
+  {
+    NODELET_INFO("TraceRecorder: tracing disabled");
+    return;
+  }
+
+  if(writePeriod > 0.0)
+  {
+    m_writeTimer = nhPvt.createTimer(ros::Duration(writePeriod),
+                                     &TraceRecorder::writeTimerCallback, this);
+  }
+  NODELET_INFO_STREAM("TraceRecorder: tracing to " << m_outputFile);
+}
+
+void TraceRecorder::writeTrace()
+{
+  if(!Trace::writeChromeTrace(m_outputFile))
+  {
+    NODELET_ERROR_STREAM("TraceRecorder: could not write " << m_outputFile);
+  }
+}
+
+void TraceRecorder::writeTimerCallback(const ros::TimerEvent& /*time*/)
+{
+  writeTrace();
+}
+
+}
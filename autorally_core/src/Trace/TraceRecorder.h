@@ -0,0 +1,69 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TraceRecorder.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief TraceRecorder class definition
+ *
+ ***********************************************/
+#ifndef TRACE_RECORDER_H_
+#define TRACE_RECORDER_H_
+
+#include <string>
+
+#include <ros/ros.h>
+#include <nodelet/nodelet.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class TraceRecorder TraceRecorder.h
+ *  @brief Enables pipeline tracing in a nodelet manager and exports it
+ *
+ *  Tracing is process wide, so loading this nodelet into a manager traces
+ *  every nodelet running in that manager. The most recent events from each
+ *  thread are written to outputFile every writePeriod seconds and when the
+ *  nodelet is unloaded. Open the file in chrome://tracing or ui.perfetto.dev.
+ */
+class TraceRecorder : public nodelet::Nodelet
+{
+ public:
+  ~TraceRecorder();
+
+  virtual void onInit();
+
+ private:
+  std::string m_outputFile; ///< Chrome trace JSON file to write
+  ros::Timer m_writeTimer; ///< Timer to periodically write the trace
+
+  void writeTrace();
+  void writeTimerCallback(const ros::TimerEvent& time);
+};
+
+}
+#endif //TRACE_RECORDER_H_
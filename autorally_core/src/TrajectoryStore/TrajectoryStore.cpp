@@ -0,0 +1,192 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TrajectoryStore.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief TrajectoryStore class implementation
+ *
+ ***********************************************/
+#include <autorally_core/TrajectoryStore.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace autorally_core
+{
+
+namespace
+{
+  bool stampLess(const TrajectoryStore::State& state, const ros::Time& stamp)
+  {
+    return state.stamp < stamp;
+  }
+}
+
+TrajectoryStore::TrajectoryStore(const ros::Duration& maxAge) :
+  m_maxAge(maxAge)
+{}
+
+void TrajectoryStore::setMaxAge(const ros::Duration& maxAge)
+{
+  boost::mutex::scoped_lock lock(m_mutex);
+  m_maxAge = maxAge;
+}
+
+void TrajectoryStore::add(const State& state)
+{
+  boost::mutex::scoped_lock lock(m_mutex);
+  if(m_states.empty() || m_states.back().stamp < state.stamp)
+  {
+    m_states.push_back(state);
+  } else
+  {
+    std::deque<State>::iterator it = std::lower_bound(m_states.begin(), m_states.end(), state.stamp, stampLess);
+    if(it != m_states.end() && it->stamp == state.stamp)
+    {
+      *it = state;
+    } else
+    {
+      m_states.insert(it, state);
+    }
+  }
+
+  ros::Time cutoff = (m_states.back().stamp.toSec() > m_maxAge.toSec()) ?
+                     m_states.back().stamp - m_maxAge : ros::Time();
+  while(!m_states.empty() && m_states.front().stamp < cutoff)
+  {
+    m_states.pop_front();
+  }
+}
+
+bool TrajectoryStore::lookup(const ros::Time& stamp, State& state) const
+{
+  boost::mutex::scoped_lock lock(m_mutex);
+  if(m_states.empty() || stamp < m_states.front().stamp || m_states.back().stamp < stamp)
+  {
+    return false;
+  }
+
+  std::deque<State>::const_iterator after = std::lower_bound(m_states.begin(), m_states.end(), stamp, stampLess);
+  if(after->stamp == stamp)
+  {
+    state = *after;
+    return true;
+  }
+  std::deque<State>::const_iterator before = after-1;
+  double alpha = (stamp-before->stamp).toSec() / (after->stamp-before->stamp).toSec();
+  state = interpolate(*before, *after, alpha);
+  state.stamp = stamp;
+  return true;
+}
+
+size_t TrajectoryStore::size() const
+{
+  boost::mutex::scoped_lock lock(m_mutex);
+  return m_states.size();
+}
+
+ros::Time TrajectoryStore::oldest() const
+{
+  boost::mutex::scoped_lock lock(m_mutex);
+  return m_states.empty() ? ros::Time() : m_states.front().stamp;
+}
+
+ros::Time TrajectoryStore::newest() const
+{
+  boost::mutex::scoped_lock lock(m_mutex);
+  return m_states.empty() ? ros::Time() : m_states.back().stamp;
+}
+
+boost::shared_ptr<TrajectoryStore> TrajectoryStore::get(const std::string& name)
+{
+  static boost::mutex registryMutex;
+  static std::map<std::string, boost::shared_ptr<TrajectoryStore> > registry;
+
+  boost::mutex::scoped_lock lock(registryMutex);
+  boost::shared_ptr<TrajectoryStore>& store = registry[name];
+  if(!store)
+  {
+    store.reset(new TrajectoryStore);
+  }
+  return store;
+}
+
+TrajectoryStore::State TrajectoryStore::interpolate(const State& a, const State& b, double alpha)
+{
+  State s;
+  s.stamp = a.stamp + (b.stamp-a.stamp)*alpha;
+  s.optimized = a.optimized && b.optimized;
+
+  s.pose.position.x = a.pose.position.x + alpha*(b.pose.position.x-a.pose.position.x);
+  s.pose.position.y = a.pose.position.y + alpha*(b.pose.position.y-a.pose.position.y);
+  s.pose.position.z = a.pose.position.z + alpha*(b.pose.position.z-a.pose.position.z);
+
+  s.twist.linear.x = a.twist.linear.x + alpha*(b.twist.linear.x-a.twist.linear.x);
+  s.twist.linear.y = a.twist.linear.y + alpha*(b.twist.linear.y-a.twist.linear.y);
+  s.twist.linear.z = a.twist.linear.z + alpha*(b.twist.linear.z-a.twist.linear.z);
+  s.twist.angular.x = a.twist.angular.x + alpha*(b.twist.angular.x-a.twist.angular.x);
+  s.twist.angular.y = a.twist.angular.y + alpha*(b.twist.angular.y-a.twist.angular.y);
+  s.twist.angular.z = a.twist.angular.z + alpha*(b.twist.angular.z-a.twist.angular.z);
+
+  //slerp along the shorter arc
+  const geometry_msgs::Quaternion& qa = a.pose.orientation;
+  geometry_msgs::Quaternion qb = b.pose.orientation;
+  double dot = qa.x*qb.x + qa.y*qb.y + qa.z*qb.z + qa.w*qb.w;
+  if(dot < 0.0)
+  {
+    dot = -dot;
+    qb.x = -qb.x;
+    qb.y = -qb.y;
+    qb.z = -qb.z;
+    qb.w = -qb.w;
+  }
+  double wa, wb;
+  if(dot > 0.9995)
+  {
+    wa = 1.0-alpha;
+    wb = alpha;
+  } else
+  {
+    double theta = std::acos(dot);
+    wa = std::sin((1.0-alpha)*theta)/std::sin(theta);
+    wb = std::sin(alpha*theta)/std::sin(theta);
+  }
+  geometry_msgs::Quaternion& q = s.pose.orientation;
+  q.x = wa*qa.x + wb*qb.x;
+  q.y = wa*qa.y + wb*qb.y;
+  q.z = wa*qa.z + wb*qb.z;
+  q.w = wa*qa.w + wb*qb.w;
+  double norm = std::sqrt(q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w);
+  q.x /= norm;
+  q.y /= norm;
+  q.z /= norm;
+  q.w /= norm;
+  return s;
+}
+
+}
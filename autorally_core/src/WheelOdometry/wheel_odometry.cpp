@@ -34,19 +34,32 @@
  **/
 #include "wheel_odometry.h"
 #include <tf/transform_datatypes.h>
+#include <pluginlib/class_list_macros.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_core, WheelOdometry, autorally_core::WheelOdometry, nodelet::Nodelet)
 
 namespace autorally_core
 {
-WheelOdometry::WheelOdometry()
+WheelOdometry::WheelOdometry():
+  debug_(false),
+  using_sim_(false),
+  time_delay_(0.0),
+  length_(0.0),
+  width_(0.0)
+{
+}
+
+void WheelOdometry::onInit()
 {
-  ros::NodeHandle n;
+  ros::NodeHandle n = getNodeHandle();
+  ros::NodeHandle nPvt = getPrivateNodeHandle();
 
-  n.getParam("vehicle_wheelbase", length_);
-  n.getParam("vehicle_width", width_);
-  n.getParam("using_sim", using_sim_);
-  n.getParam("time_delay", time_delay_);
+  nPvt.getParam("vehicle_wheelbase", length_);
+  nPvt.getParam("vehicle_width", width_);
+  nPvt.getParam("using_sim", using_sim_);
+  nPvt.getParam("time_delay", time_delay_);
   // debug mode publishes a different message and subscribes to state estimator for easy visualization
-  n.getParam("debug", debug_);
+  nPvt.getParam("debug", debug_);
 
   servo_sub_ = n.subscribe("chassisState", 1, &WheelOdometry::servoCallback, this);
   wheel_speeds_sub_ = n.subscribe("wheelSpeeds", 1, &WheelOdometry::speedCallback, this);
@@ -314,10 +327,3 @@ void WheelOdometry::speedCallback(const autorally_msgs::wheelSpeedsConstPtr& spe
   odom_.publish(odom_msg);
 }
 }
-int main(int argc, char** argv)
-{
-  ros::init(argc, argv, "WheelOdometry");
-  autorally_core::WheelOdometry wheelOdometry;
-  ros::spin();
-  return 0;
-}
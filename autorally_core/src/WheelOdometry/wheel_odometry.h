@@ -38,6 +38,7 @@
 #include <math.h>
 
 #include "ros/ros.h"
+#include <nodelet/nodelet.h>
 #include <autorally_msgs/chassisState.h>
 #include <autorally_msgs/wheelSpeeds.h>
 #include <nav_msgs/Odometry.h>
@@ -56,15 +57,17 @@ namespace autorally_core
 * - nav_msgs::Odometry messages with the vehicle's position, orientation, and linear and angular velocities with their
 * respective covariances
 */
-class WheelOdometry
+class WheelOdometry : public nodelet::Nodelet
 {
 public:
-  /**
-    * Contructor that recieves parameters and initializes subscribers and publishers
-    */
   WheelOdometry();
   ~WheelOdometry();
 
+  /**
+    * Recieves parameters and initializes subscribers and publishers
+    */
+  virtual void onInit();
+
 private:
   const double PI = 3.14159265; ///< Value for pi
   const double MAX_SERVO_VAL = 0.65; ///< Maximum servo value vehicle will steer
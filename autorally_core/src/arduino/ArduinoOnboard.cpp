@@ -34,6 +34,7 @@
  * @details Contains ArdionoOnboard class implementation
  ***********************************************/
 #include "ArduinoOnboard.h"
+#include <autorally_core/Trace.h>
 
 #include <pluginlib/class_list_macros.h>
 
@@ -47,10 +48,17 @@ namespace autorally_core
 {
 
 ArduinoOnboard::ArduinoOnboard():
+  m_decoder(arduinoOnboardKeys),
+  m_triggerFPS(0),
+  m_fpsReconnects(0),
+  m_seenReconnects(0),
+  m_seenReconnectFrames(0),
   m_lfSum(0.0),
   m_rfSum(0.0),
   m_lbSum(0.0),
-  m_rbSum(0.0)
+  m_rbSum(0.0),
+  m_steeringPresent(false),
+  m_throttlePresent(false)
 {}
 
 ArduinoOnboard::~ArduinoOnboard()
@@ -63,13 +71,11 @@ void ArduinoOnboard::onInit()
   ros::NodeHandle nh = getNodeHandle();
   m_nhPvt = getPrivateNodeHandle();
 
-  m_lastTime = ros::Time::now();
  	std::string port;
 
   if(!m_nhPvt.getParam("port", port) ||
      !m_nhPvt.getParam("numMovingAverageValues", m_numMovingAverageValues) ||
      !m_nhPvt.getParam("wheelDiameter", m_wheelDiameter) ||
-     !m_nhPvt.getParam("triggerFPS", m_triggerFPS) ||
      !m_nhPvt.getParam("srvBatteryCrit", srvBatteryCrit) ||
      !m_nhPvt.getParam("srvBatteryLow", srvBatteryLow) ||
      !m_nhPvt.getParam("camBatteryCrit", camBatteryCrit) ||
@@ -91,90 +97,55 @@ void ArduinoOnboard::onInit()
 	m_port.registerDataCallback(
                       boost::bind(&ArduinoOnboard::arduinoDataCallback, this));
 
+  double diagFreq;
+  ros::param::param<double>("diagnosticsFrequency", diagFreq, 1.0);
+  m_diagTimer = nh.createTimer(ros::Duration(diagFreq), &ArduinoOnboard::diagnostics, this);
+
   loadServoParams();
+
+  //set up dynamic_reconfigure server, the initial triggerFPS is sent to the arduino from configCallback
+  m_dynReconfigServer.reset(new dynamic_reconfigure::Server<arduino_onboard_paramsConfig>(m_nhPvt));
+  dynamic_reconfigure::Server<arduino_onboard_paramsConfig>::CallbackType cb;
+  cb = boost::bind(&ArduinoOnboard::configCallback, this, _1, _2);
+  m_dynReconfigServer->setCallback(cb);
 }
 
 void ArduinoOnboard::arduinoDataCallback()
 {
-  std::string msg;
-
 // These are super expensive on the jetson
 //  m_nhPvt.getParam("srvBatteryCrit", srvBatteryCrit);
 //  m_nhPvt.getParam("srvBatteryLow", srvBatteryLow);
 //  m_nhPvt.getParam("camBatteryCrit", camBatteryCrit);
 //  m_nhPvt.getParam("camBatteryLow", camBatteryLow);
 
-  while(findMessage(msg))
+  ArduinoOnboardData data;
+  unsigned int found;
+  while(nextMessage(data, found))
   {
+    TraceSpan span("ArduinoOnboard::arduinoDataCallback");
     //allocate new wheelSpeeds message
     autorally_msgs::wheelSpeedsPtr wheelSpeeds(new autorally_msgs::wheelSpeeds);
     wheelSpeeds->header.stamp = ros::Time::now();
 
-    boost::char_separator<char> seps(":,\n");
-    tokenizer tok(msg, seps);
-    tokenizer::iterator it=tok.begin();
-
     //allocate new servo message for RC servoCommand
     autorally_msgs::chassisCommandPtr servos(new autorally_msgs::chassisCommand);
     servos->sender = "RC";
     servos->frontBrake = -5.0;
 
-    double lf, rf, lb, rb;
-    bool wheels = false;
-    //bool servo = false;
-    //bool camera = false;
-    bool rc = false;
-
-    while(it!=tok.end())
+    if(found != (ArduinoOnboardData::WHEELS | ArduinoOnboardData::RC))
     {
-      if(*it == "wheels")
-      {
-        if(++it == tok.end()) break;
-        lf = atof(it->c_str());
-
-        if(++it == tok.end()) break;
-        rf = atof(it->c_str());
-
-        if(++it == tok.end()) break;
-        lb = atof(it->c_str());
-
-        if(++it == tok.end()) break;
-        rb = atof(it->c_str());
-
-        wheels = true;
-      //} else if(*it == "servo")
-      //{
-      //  if(++it == tok.end()) break;
-      //  m_port.diag("Servo Battery Voltage", *it);
-      //  servo = true;
-      //} else if(*it == "camera")
-      //{
-      //  if(++it == tok.end()) break;
-      //  m_port.diag("Camera Battery Voltage", *it);
-      //  camera = true;
-      } else if(*it == "rc")
-      {
-        if(++it == tok.end()) break;
-        servos->throttle = atof(it->c_str());
-
-        if(++it == tok.end()) break;
-        servos->steering = atof(it->c_str());
-        rc = true;
-      } else
-      {
-        NODELET_ERROR("ArduinoOnboard: Bad token %s", it->c_str());
-        m_port.diag_warn("ArduinoOnboard got a bad token");
-      }
-
-      if(it!=tok.end())
-      {
-        ++it;
-      }
+      NODELET_ERROR("ArduinoOnboard: Incomplete packet %d %d", (found & ArduinoOnboardData::WHEELS) != 0,
+                    (found & ArduinoOnboardData::RC) != 0);
+      m_port.diag_warn("ArduinoOnboard: Incomplete packet");
     }
-    if(!(wheels && rc))
+    double lf = (found & ArduinoOnboardData::WHEELS) ? data.lf : 0.0;
+    double rf = (found & ArduinoOnboardData::WHEELS) ? data.rf : 0.0;
+    double lb = (found & ArduinoOnboardData::WHEELS) ? data.lb : 0.0;
+    double rb = (found & ArduinoOnboardData::WHEELS) ? data.rb : 0.0;
+    if(found & ArduinoOnboardData::RC)
     {
-      NODELET_ERROR("ArduinoOnboard: Incomplete packet %d %d", wheels, rc);
-      m_port.diag_warn("ArduinoOnboard: Incomplete packet");
+      servos->throttle = data.rcThrottle;
+      servos->steering = data.rcSteering;
     }
 
     if(isnan(lf)) lf = 0.0;
@@ -207,107 +178,96 @@ void ArduinoOnboard::arduinoDataCallback()
 
     //Calculate servo commands
     //Raw data from arduino is in units of 500 ns.
-    servos->throttle /= 2.0;
-    servos->steering /= 2.0;
-    std::map<std::string, ServoSettings>::const_iterator mapIt;
-
-    if( (mapIt = m_servoSettings.find("steering")) != m_servoSettings.end())
+    if(m_steeringPresent)
     {
-      if(servos->steering > mapIt->second.center)
-      {
-        servos->steering = (servos->steering - mapIt->second.center) / (mapIt->second.max-mapIt->second.center);
-        if (servos->steering > 1.0)
-            servos->steering = 1.0;
-      } else if(servos->steering < mapIt->second.center)
-      {
-        servos->steering = (servos->steering-mapIt->second.center)/(mapIt->second.center-mapIt->second.min);
-        if (servos->steering < -1.0)
-            servos->steering = -1.0;
-      } else
-      {
-        servos->steering = 0.0;
-      }
-
-      if(mapIt->second.reverse)
-      {
-        servos->steering = -servos->steering;
-      }
+      servos->steering = pulseToCommand(servos->steering/2.0, m_steering);
+    } else
+    {
+      servos->steering /= 2.0;
     }
-    if( (mapIt = m_servoSettings.find("throttle")) != m_servoSettings.end())
+    if(m_throttlePresent)
     {
-      if(servos->throttle > mapIt->second.center)
-      {
-        servos->throttle = (servos->throttle - mapIt->second.center) / (mapIt->second.max-mapIt->second.center);
-        if (servos->throttle > 1.0)
-            servos->throttle = 1.0;
-      } else if(servos->throttle < mapIt->second.center)
-      {
-        servos->throttle = (servos->throttle-mapIt->second.center)/(mapIt->second.center-mapIt->second.min);
-        if (servos->throttle < -1.0)
-            servos->throttle = -1.0;
-      } else
-      {
-        servos->throttle = 0.0;
-      }
-
-      if(mapIt->second.reverse)
-      {
-        servos->throttle = -servos->throttle;
-      }
+      servos->throttle = pulseToCommand(servos->throttle/2.0, m_throttle);
+    } else
+    {
+      servos->throttle /= 2.0;
     }
 
-    
-    servos->header.stamp = ros::Time::now();
-
-    if (m_lastTime + ros::Duration(2.0) > ros::Time::now()) {
-      m_lastTime = ros::Time::now();
-      //set FPS
-      int newFPS = 0;
-      m_nhPvt.getParam("triggerFPS", newFPS);
-      if(newFPS != m_triggerFPS)
-      {
-        m_triggerFPS = newFPS;
-        m_port.lock();
-        m_port.writePort("#fps:" + std::to_string(m_triggerFPS) + "\r\n");
-        m_port.unlock();
-      }
-    }
+    servos->header.stamp = wheelSpeeds->header.stamp;
 
     //publish data
+    span.setNextId(Trace::id(wheelSpeeds->header.stamp));
     m_wheelSpeedPub.publish(wheelSpeeds);
     m_servoPub.publish(servos);
     m_port.tick("arduinoData");
-    m_port.diag("Triggering FPS", std::to_string(m_triggerFPS));
   }
 }
 
-bool ArduinoOnboard::findMessage(std::string& msg)
+void ArduinoOnboard::diagnostics(const ros::TimerEvent& /*time*/)
 {
+  //diagnostics are cleared after every publish, so post the counters each period
   m_port.lock();
-  if(m_port.m_data.size() > 10)
+  AsciiDecoderStats stats = m_decoder.stats();
+  m_port.unlock();
+
+  m_port.diag("Bad frames", std::to_string(stats.badFrames));
+  m_port.diag("Bad records", std::to_string(stats.badRecords+stats.unknownKeys));
+  m_port.diag("Triggering FPS", std::to_string(m_triggerFPS));
+
+  //a reconnected arduino has reset to its default rate, restore the configured one once it streams again
+  unsigned int reconnects = m_port.reconnects();
+  if(reconnects != m_seenReconnects)
   {
-    //make sure data is framed
-    if(m_port.m_data[0] != '#')
-    {
-      size_t start = m_port.m_data.find("#");
-      m_port.m_data.erase(0, start);
-    }
+    m_seenReconnects = reconnects;
+    m_seenReconnectFrames = stats.frames;
+  } else if(reconnects != m_fpsReconnects && stats.frames > m_seenReconnectFrames)
+  {
+    m_fpsReconnects = reconnects;
+    sendTriggerFPS();
+  }
+}
 
-    //try to pull out a full message
-    size_t end = m_port.m_data.find("\r\n");
-    if(end != std::string::npos)
-    {
-      //std::cout << "Looking at^" << m_port.m_data << "^" << std::endl;
-      //remove # at beginning and trailing \r\n before further processing
-      msg = m_port.m_data.substr(1,end-1);
-      //erase through \r\n at end of message
-      m_port.m_data.erase(0,end+2);
-      m_port.unlock();
-      return true;
-    }
+double ArduinoOnboard::pulseToCommand(double pulse, const ServoSettings& servo) const
+{
+  double command = 0.0;
+  if(pulse > servo.center)
+  {
+    command = (pulse - servo.center) / (servo.max-servo.center);
+    if (command > 1.0)
+        command = 1.0;
+  } else if(pulse < servo.center)
+  {
+    command = (pulse-servo.center)/(servo.center-servo.min);
+    if (command < -1.0)
+        command = -1.0;
   }
+
+  return (servo.reverse) ? -command : command;
+}
+
+void ArduinoOnboard::configCallback(const arduino_onboard_paramsConfig &config, uint32_t /*level*/)
+{
+  m_triggerFPS = config.triggerFPS;
+
+  //send new FPS to arduino
+  sendTriggerFPS();
+}
+
+void ArduinoOnboard::sendTriggerFPS()
+{
+  m_port.lock();
+  m_port.writePort("#fps:" + std::to_string(m_triggerFPS) + "\r\n");
   m_port.unlock();
-  return false;
+}
+
+bool ArduinoOnboard::nextMessage(ArduinoOnboardData& data, unsigned int& found)
+{
+  size_t offset = 0;
+  m_port.lock();
+  bool decoded = m_decoder.next(m_port.m_data, offset, data, found);
+  m_port.m_data.erase(0, offset);
+  m_port.unlock();
+  return decoded;
 }
 
 void ArduinoOnboard::loadServoParams()
@@ -345,6 +305,17 @@ void ArduinoOnboard::loadServoParams()
   }
   NODELET_INFO("ServoInterface: Loaded %u servos", (unsigned int)m_servoSettings.size());
 
+  //resolve the servos used for RC commands once instead of on every message
+  std::map<std::string, ServoSettings>::const_iterator mapIt;
+  if( (m_steeringPresent = ((mapIt = m_servoSettings.find("steering")) != m_servoSettings.end())) )
+  {
+    m_steering = mapIt->second;
+  }
+  if( (m_throttlePresent = ((mapIt = m_servoSettings.find("throttle")) != m_servoSettings.end())) )
+  {
+    m_throttle = mapIt->second;
+  }
+
 }
 
 
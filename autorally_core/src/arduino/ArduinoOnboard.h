@@ -41,14 +41,18 @@
 #include <ros/ros.h>
 #include <ros/time.h>
 #include <nodelet/nodelet.h>
+#include <dynamic_reconfigure/server.h>
 //#include <std_msgs/Float64.h>
 #include <autorally_core/SerialInterfaceThreaded.h>
+#include <autorally_core/AsciiProtocols.h>
 #include <autorally_msgs/wheelSpeeds.h>
 #include <autorally_msgs/chassisCommand.h>
+#include <autorally_core/arduino_onboard_paramsConfig.h>
 
-#include <boost/tokenizer.hpp>
 //#include <boost/circular_buffer.hpp>
 
+#include <boost/shared_ptr.hpp>
+
 #include <stdio.h>
 #include <string>
 
@@ -89,14 +93,20 @@ class ArduinoOnboard : public nodelet::Nodelet
   ros::Publisher m_diagPub; ///<Publisher for diagnostics
   ros::Publisher m_servoPub;  ///<Publish servo messages from the RC transmitter
 
-  ros::Time m_lastTime;
-
+  ros::Timer m_diagTimer; ///< Posts the decoder counters and trigger rate every diagnostics period
   SerialInterfaceThreaded m_port; ///<Serial port for arduino data
+  AsciiDecoder<ArduinoOnboardData> m_decoder; ///< Decoder for messages from the arduino
+
+  ///< Dynamic Reconfigure server used for changing the triggering rate on the fly
+  boost::shared_ptr<dynamic_reconfigure::Server<arduino_onboard_paramsConfig> > m_dynReconfigServer;
 
   double m_wheelDiameter; ///<Diameter of wheels on vehicle in m
   int m_numMovingAverageValues; ///< Number of values used in moving average
 
   int m_triggerFPS; ///< Frame rate for the camera external trigger
+  unsigned int m_fpsReconnects; ///< Port reconnect count m_triggerFPS was last restored after
+  unsigned int m_seenReconnects; ///< Port reconnect count at the previous diagnostics period
+  unsigned long m_seenReconnectFrames; ///< Decoded frame count when m_seenReconnects last changed
 
   double m_lfSum; ///< Moving average sum for the front left sensor
   double m_rfSum; ///< Moving average sum for the front right sensor
@@ -118,16 +128,41 @@ class ArduinoOnboard : public nodelet::Nodelet
   bool m_lbEnabled;
   bool m_rbEnabled;
 
-  typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
-
     /**
-   * @brief Process incoming data stream to pull out complete message strings
-   * @return bool if a complete message string was found and processed
+   * @brief Process incoming data stream and publish every complete message
    */
   void arduinoDataCallback();
-  bool findMessage(std::string& msg);
+
+  /**
+   * @brief Time triggered callback to post decoder counters and the trigger rate to diagnostics
+   * @param time information about callback firing
+   *
+   * The trigger rate is also re-sent after the port reconnects, since the arduino restarts at its default rate.
+   * It is sent once frames arrive again, the port reopens before the arduino has booted and listens.
+   */
+  void diagnostics(const ros::TimerEvent& time);
+
+  /**
+   * @brief Send m_triggerFPS to the arduino
+   */
+  void sendTriggerFPS();
+
+  /**
+   * @brief Decode the next complete message received from the arduino
+   * @param data receives the decoded values
+   * @param found set to the ArduinoOnboardData::Key records present in the message
+   * @return bool if a complete message was found
+   */
+  bool nextMessage(ArduinoOnboardData& data, unsigned int& found);
   void loadServoParams();
 
+  /**
+   * @brief Callback triggered when a new message is received from dynamic reconfigure srever
+   * @param config the new configuration
+   * @param level bitmask of the changed parameters
+   */
+  void configCallback(const arduino_onboard_paramsConfig &config, uint32_t level);
+
   struct ServoSettings
   {
     unsigned short center; ///< calibrated zero of servo in us
@@ -149,6 +184,18 @@ class ArduinoOnboard : public nodelet::Nodelet
   };
 
   std::map<std::string, ServoSettings> m_servoSettings;
+  ServoSettings m_steering; ///< Steering settings, resolved from m_servoSettings at load
+  ServoSettings m_throttle; ///< Throttle settings, resolved from m_servoSettings at load
+  bool m_steeringPresent; ///< If steering is configured
+  bool m_throttlePresent; ///< If throttle is configured
+
+  /**
+   * @brief Scale an RC pulse width to a command on [-1.0, 1.0]
+   * @param pulse pulse width in us
+   * @param servo calibration of the servo the pulse drives
+   * @return the scaled command
+   */
+  double pulseToCommand(double pulse, const ServoSettings& servo) const;
 };
 
 }
@@ -41,6 +41,8 @@
 
 #include "AutoRallyChassis.h"
 
+#include <autorally_core/Trace.h>
+
 PLUGINLIB_DECLARE_CLASS(autorally_core, AutoRallyChassis, autorally_core::AutoRallyChassis, nodelet::Nodelet)
 
 namespace autorally_core
@@ -69,37 +71,33 @@ void AutoRallyChassis::onInit()
                      ("RC/chassisCommand", 1);
 
   loadChassisConfig();
-  loadChassisCommandPriorities();
   serialPort_.init(nh, getName(), "", "AutoRallyChassis", port, true);
   
   double commandRate = 0.0;
-  double chassisCommandMaxAge = 0.0;
-  double runstopMaxAge = 0.0;
   escDataFailCounter_ = 0;
 
   //need entry for each escDataFailCounter_actuator read from RC receiver to keep track of pulse statistics
   invalidActuatorPulses_["throttle"] = std::pair<bool, int>(false, 0);
   invalidActuatorPulses_["steering"] = std::pair<bool, int>(false, 0);
 
+  bool arbiterOk = arbiter_.init(nh, nhPvt, getName());
   if(!nhPvt.getParam("commandRate", commandRate) ||
-     !nhPvt.getParam("commandMaxAge", chassisCommandMaxAge) ||
      !nhPvt.getParam("wheelDiameter", wheelDiameter_) ||
-     !nhPvt.getParam("runstopMaxAge", runstopMaxAge))
+     !arbiterOk)
   {
     NODELET_ERROR_STREAM(getName() << " could not get all startup params");
   }
-  chassisCommandMaxAge_ = ros::Duration(chassisCommandMaxAge);
-  runstopMaxAge_ = ros::Duration(runstopMaxAge);
 
-  for (auto& mapIt : chassisCommands_)
+  nhPvt.param("safeSpeed/enabled", safeSpeedEnabled_, false);
+  if(safeSpeedEnabled_)
   {
-    std::string topic = mapIt.first+"/chassisCommand";
-    ros::Subscriber sub = nh.subscribe(topic, 1,
-                                       &AutoRallyChassis::chassisCommandCallback, this);
-    chassisCommandSub_[mapIt.first] = sub;
+    safeSpeed_.init(nh, nhPvt);
+
+    double diagFreq;
+    ros::param::param<double>("diagnosticsFrequency", diagFreq, 1.0);
+    diagTimer_ = nh.createTimer(ros::Duration(diagFreq), &AutoRallyChassis::diagnostics, this);
   }
-  runstopSub_ = nh.subscribe("/runstop", 5, &AutoRallyChassis::runstopCallback, this);  
-  
+
   //callback for serial data from chassis
   serialPort_.registerDataCallback(boost::bind(&AutoRallyChassis::chassisFeedbackCallback, this));
 
@@ -107,23 +105,6 @@ void AutoRallyChassis::onInit()
                       &AutoRallyChassis::setChassisActuators, this);
 }
 
-//subscribe to a one topic for every chassis commander listed in the chassis commander priorities file
-void AutoRallyChassis::chassisCommandCallback(
-                     const autorally_msgs::chassisCommandConstPtr& msg)
-{
-  std::map<std::string, autorally_msgs::chassisCommand>::iterator mapIt;
-  if((mapIt = chassisCommands_.find(msg->sender)) == chassisCommands_.end())
-  {
-    NODELET_ERROR_STREAM("AutoRallyChassis: Unknown controller " <<
-                         msg->sender <<
-                         " attempting to control chassis, please add entry " <<
-                         " to chassisCommandPriorities.yaml");
-  }
-  {
-    mapIt->second = *msg;
-  }
-}
-
 void AutoRallyChassis::chassisFeedbackCallback()
 {
   //Any variables accessed in here and in other places in the code need to be mutex'd as this fires in a different
@@ -176,6 +157,7 @@ void AutoRallyChassis::processChassisMessage(std::string msgType, std::string ms
     //wheel speeds data as comma separated doubles, units in m/s
     case 'w':
     {
+      TraceSpan span("AutoRallyChassis::wheelSpeeds");
       std::vector<std::string> data;
       boost::split(data, msg, boost::is_any_of(","));
       if(data.size() == 4)
@@ -192,6 +174,7 @@ void AutoRallyChassis::processChassisMessage(std::string msgType, std::string ms
           if(wheelSpeedsPub_ && !ros::isShuttingDown())
           {
             wheelSpeeds->header.stamp = ros::Time::now();
+            span.setNextId(Trace::id(wheelSpeeds->header.stamp));
             wheelSpeedsPub_.publish(wheelSpeeds);
           }
           serialPort_.tick("wheelSpeeds data");
@@ -306,80 +289,21 @@ void AutoRallyChassis::processChassisMessage(std::string msgType, std::string ms
 
 void AutoRallyChassis::setChassisActuators(const ros::TimerEvent&)
 {
+  TraceSpan span("AutoRallyChassis::setChassisActuators");
   autorally_msgs::chassisStatePtr chassisState(new autorally_msgs::chassisState);
   
-  chassisState->steeringCommander = "";
-  chassisState->steering = 0.0;
-
-  chassisState->throttleCommander = "";
-  chassisState->throttle = 0.0;
-
-  chassisState->frontBrakeCommander = "";
-  chassisState->frontBrake = 0.0;
-
   ros::Time currentTime = ros::Time::now();
 
-  //check if motion is enabled (all runstop message runstopMotionEnabled = true)
-  if(runstops_.empty())
+  ros::Time throttleStamp = arbiter_.arbitrate(currentTime, *chassisState);
+  if(!throttleStamp.isZero())
   {
-    chassisState->runstopMotionEnabled = false;
-  } else
-  {
-    chassisState->runstopMotionEnabled = true;
-    int validRunstopCount = 0;
-    for(auto& runstop : runstops_)
-    {
-      if(currentTime-runstop.second.header.stamp < runstopMaxAge_)
-      {
-        ++validRunstopCount;
-        if(runstop.second.motionEnabled == 0)
-        {
-          chassisState->runstopMotionEnabled = false;
-          chassisState->throttleCommander = "runstop";
-        }
-      }
-    }
-    if(validRunstopCount == 0)
-    {
-      chassisState->runstopMotionEnabled = false;
-      chassisState->throttleCommander = "runstop";
-      chassisState->throttle = 0.0;
-    }
+    span.setId(Trace::id(throttleStamp));
   }
 
-  //find highest priority (lowest valuemostRecentRc_) command message for each actuator across all valid actuator commands
-  for(auto & vecIt : chassisCommandPriorities_)
+  //limit the throttle of whoever won arbitration to the current safe speed
+  if(safeSpeedEnabled_ && chassisState->runstopMotionEnabled && !chassisState->throttleCommander.empty())
   {
-    if( currentTime-chassisCommands_[vecIt.id].header.stamp < chassisCommandMaxAge_)
-    {
-      //valid throttle commands are on [-1,1], only set throttle value if runstop is enabled
-      if(chassisState->throttleCommander.empty() && chassisState->runstopMotionEnabled &&
-         chassisCommands_[vecIt.id].throttle <= 1.0 &&
-         chassisCommands_[vecIt.id].throttle >= -1.0)
-      {
-        chassisState->throttleCommander = chassisCommands_[vecIt.id].sender;
-        chassisState->throttle = chassisCommands_[vecIt.id].throttle;
-      }
-
-      //valid steeringBrake commands are on [-1,1]
-      if(chassisState->steeringCommander.empty() &&
-         chassisCommands_[vecIt.id].steering <= 1.0 &&
-         chassisCommands_[vecIt.id].steering >= -1.0)
-      {
-        chassisState->steeringCommander = chassisCommands_[vecIt.id].sender;
-        chassisState->steering = chassisCommands_[vecIt.id].steering;
-      }
-
-      //valid frontBrake commands are on [0,1]
-      if(chassisState->frontBrakeCommander.empty() &&
-         chassisCommands_[vecIt.id].frontBrake <= 1.0 &&
-         chassisCommands_[vecIt.id].frontBrake >= 0.0)
-      {
-        chassisState->frontBrakeCommander = chassisCommands_[vecIt.id].sender;
-        chassisState->frontBrake = chassisCommands_[vecIt.id].frontBrake;
-      }
-
-    }
+    chassisState->throttle = safeSpeed_.safeThrottle(chassisState->throttle, currentTime);
   }
 
   //send actuator commands down to chassis, sets to calibrated neutral if no valid commander
@@ -424,6 +348,12 @@ void AutoRallyChassis::setChassisActuators(const ros::TimerEvent&)
   serialPort_.tick("chassisState pub");
 }
 
+void AutoRallyChassis::diagnostics(const ros::TimerEvent& /*time*/)
+{
+  //posted once per diagnostics period instead of from every command period
+  serialPort_.diag("safeSpeed in control", (safeSpeed_.inControl()) ? "true" : "false");
+}
+
 void AutoRallyChassis::sendCommandToChassis(autorally_msgs::chassisStatePtr& state)
 {
   /*
@@ -460,6 +390,7 @@ void AutoRallyChassis::sendCommandToChassis(autorally_msgs::chassisStatePtr& sta
   //message end signal
   actuatorCmd[8] = '\n';
 
+  TraceSpan span("AutoRallyChassis::sendCommandToChassis");
   serialPort_.writePort(actuatorCmd);
 }
 
@@ -564,44 +495,4 @@ void AutoRallyChassis::loadChassisConfig()
 
 }
 
-void AutoRallyChassis::loadChassisCommandPriorities()
-{
-  //read in chassisCommandPriorities from the parameter server that were loaded by the launch file
-  ros::NodeHandle nhPvt = getPrivateNodeHandle();
-  XmlRpc::XmlRpcValue v;
-  nhPvt.param("chassisCommandProirities", v, v);
-  std::map<std::string, XmlRpc::XmlRpcValue>::iterator mapIt;
-  for(mapIt = v.begin(); mapIt != v.end(); mapIt++)
-  {
-    if(mapIt->second.getType() == XmlRpc::XmlRpcValue::TypeInt)
-    {
-      //add entry in priority queue and command map
-      priorityEntry toAdd;
-      toAdd.id = mapIt->first;
-      toAdd.priority = static_cast<int>(mapIt->second);
-      chassisCommandPriorities_.push_back(toAdd);
-      chassisCommands_[mapIt->first] = autorally_msgs::chassisCommand();
-
-    } else
-    {
-      NODELET_ERROR_STREAM(getName() << " XmlRpc chassis command priorities formatted incorrectly");
-    }
-  }
-
-  //sort the loaded commanders according to their priority
-  std::sort(chassisCommandPriorities_.begin(),
-            chassisCommandPriorities_.end(),
-            priorityComparator());
-
-  std::vector<priorityEntry>::const_iterator vecIt;
-  for(vecIt = chassisCommandPriorities_.begin();
-      vecIt != chassisCommandPriorities_.end();
-      vecIt++)
-  {
-    NODELET_INFO_STREAM(getName() << " loaded commander " << vecIt->id << " with priority " << vecIt->priority);
-  }
-  NODELET_INFO_STREAM(getName() << " loaded " <<
-                      chassisCommandPriorities_.size() << " chassis commanders");
-}
-
 }
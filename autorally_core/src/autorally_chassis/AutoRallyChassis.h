@@ -51,7 +51,9 @@
 #include <autorally_msgs/chassisCommand.h>
 #include <autorally_msgs/chassisState.h>
 
+#include <autorally_core/ChassisArbiter.h>
 #include <autorally_core/SerialInterfaceThreaded.h>
+#include <autorally_core/SafeSpeed.h>
 
 #define PI 3.141592653589793238462;
 
@@ -65,10 +67,13 @@ namespace autorally_core
  * The program allows ROS nodes to control throttle, steering, and front brake on the chassis through
  * autorally_msgs::chassisCommand messages and an associated priority. Multiple commanders may be sending command
  * messages at any one time, only the highest priority command is passed to the actuators. Each actuator can be
- * controlled by a separate commander.
+ * controlled by a separate commander. Arbitration is done by ChassisArbiter.
  *
  * autorally_msgs::runstop messages control whether motion is enabled through software. For the chassis to be driven 
  * autonomously, there must be at least on publisher of a runstop message with its motion enabled variable set to true
+ *
+ * If safeSpeed/enabled is set, the arbitrated throttle is passed through SafeSpeed, which cuts throttle while the
+ * vehicle is faster than the lowest valid autorally_msgs::safeSpeed received.
  * 
  * This program publishes:
  * - autorally_msgs::wheelSpeeds messages with the current speed of each wheel in m/s
@@ -105,46 +110,19 @@ class AutoRallyChassis : public nodelet::Nodelet
 
  private:
 
-  /*
-   * @struct priorityEntry 
-   * @brief Entry for each chassis commander loaded from the commanders file. The highest priority is 0.
-   *        
-   * @note the id must be the same as the sender in received chassisCommand messages
-   */
-  struct priorityEntry
-  {
-    std::string id; ///< Unique identifying string for a program that will control the chassis
-    unsigned int priority; ///< Priority of the commander, 0 is highest priotity
-  };
-  
-  struct priorityComparator
-  {
-    bool operator() (const priorityEntry& a, const priorityEntry& b)
-    {
-      return a.priority < b.priority;
-    }
-  };
-
   SerialInterfaceThreaded serialPort_; ///< USB connection for communication with chassis
 
-  std::map<std::string, ros::Subscriber> chassisCommandSub_; ///< Map of chassisCommand subscribers, one for each
-                                                             ///< for each chassis commander in the priorities file
-  ros::Subscriber runstopSub_; ///< Subscriber for all incoming runstop messages
+  ChassisArbiter arbiter_; ///< Chooses the commander of each actuator
   ros::Publisher chassisStatePub_; ///< Publisher for chassisState
   ros::Publisher wheelSpeedsPub_;  ///< Publisher for wheelSpeeds
   ros::Publisher chassisCommandPub_; ///< Publisher for RC chassis commands received from the chassis
   ros::Timer chassisControlTimer_; ///<Timer to trigger throttle set
+  ros::Timer diagTimer_; ///< Posts the safeSpeed state every diagnostics period
+
+  SafeSpeed safeSpeed_; ///< Speed governor applied to the arbitrated throttle command
+  bool safeSpeedEnabled_; ///< Whether safeSpeed_ limits the throttle
 
   std::map<std::string, ActuatorConfig> actuatorConfig_; ///< Map of actuator configs (min, center, max) for each
-  ros::Duration chassisCommandMaxAge_; ///< Maximum age to consider a received chassisCommand message valid
-  ros::Duration runstopMaxAge_; ///< Maximum age to consider a received runstop message valid
-  
-  std::map<std::string, autorally_msgs::chassisCommand> chassisCommands_; ///< Map of the most recently received chassis
-                                                                          ///< command from each commander
-  std::map<std::string, autorally_msgs::runstop> runstops_; ///< Map of the most recently received runstop message from
-                                                            ///< all nodes publishing the message
-  std::vector<priorityEntry> chassisCommandPriorities_; ///< Priority list used to choose which commander controls the
-                                                        ///< actuators
 
   ///< Text descriptions and multiplier values for each data register received from the ESC. This information comes from
   ///< the Castl Serial Link documenation
@@ -173,20 +151,6 @@ class AutoRallyChassis : public nodelet::Nodelet
 
   std::map<std::string, std::pair<bool, int> > invalidActuatorPulses_;
 
-  /**
-   * @brief Callback for receiving control messages
-   * @see autorally_core::chassisCommand
-   * @param msg the chassisCommand message received from ros comms
-   */
-  void chassisCommandCallback(const autorally_msgs::chassisCommandConstPtr& msg);
-
-  /**
-   * @brief Callback for incoming runstop messages
-   * @see autorally_core::runstop
-   * @param msg the runstop message received from ros comms
-   */
-  void runstopCallback(const autorally_msgs::runstopConstPtr& msg) {runstops_[msg->sender] = *msg;}
-
   /**
    * @brief Callback triggered by the serial interface when data from the chassis is available to read
    */
@@ -204,6 +168,12 @@ class AutoRallyChassis : public nodelet::Nodelet
    * @param time information about callback firing
    */
   void setChassisActuators(const ros::TimerEvent& time);
+
+  /**
+   * @brief Time triggered callback to post the safeSpeed state to diagnostics
+   * @param time information about callback firing
+   */
+  void diagnostics(const ros::TimerEvent& time);
   
   /**
    * @brief Send a set of actuator commands down to the chassis for control
@@ -239,12 +209,6 @@ class AutoRallyChassis : public nodelet::Nodelet
    *        server.
    */
   void loadChassisConfig();
-
-  /**
-   * @brief Loads list of actuator commanders with priorities loaded onto the parameter server from the .yaml
-   *        file specified in the launch file.
-   */
-  void loadChassisCommandPriorities();
 };
 
 }//end autorally_core
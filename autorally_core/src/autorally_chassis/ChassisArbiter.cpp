@@ -0,0 +1,211 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file ChassisArbiter.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Chassis command arbitration
+ *
+ * @details Implementation of the ChassisArbiter class, moved out of AutoRallyChassis
+ ***********************************************/
+#include <algorithm>
+
+#include <autorally_core/ChassisArbiter.h>
+
+namespace autorally_core
+{
+
+ChassisArbiter::ChassisArbiter()
+{}
+
+bool ChassisArbiter::init(ros::NodeHandle& nh, ros::NodeHandle& nhPvt, const std::string& name)
+{
+  name_ = name;
+  loadChassisCommandPriorities(nhPvt);
+
+  double chassisCommandMaxAge = 0.0;
+  double runstopMaxAge = 0.0;
+  bool ok = nhPvt.getParam("commandMaxAge", chassisCommandMaxAge) &&
+            nhPvt.getParam("runstopMaxAge", runstopMaxAge);
+  chassisCommandMaxAge_ = ros::Duration(chassisCommandMaxAge);
+  runstopMaxAge_ = ros::Duration(runstopMaxAge);
+
+  for (auto& mapIt : chassisCommands_)
+  {
+    std::string topic = mapIt.first+"/chassisCommand";
+    ros::Subscriber sub = nh.subscribe(topic, 1,
+                                       &ChassisArbiter::chassisCommandCallback, this);
+    chassisCommandSub_[mapIt.first] = sub;
+  }
+  runstopSub_ = nh.subscribe("/runstop", 5, &ChassisArbiter::runstopCallback, this);
+  return ok;
+}
+
+//subscribe to a one topic for every chassis commander listed in the chassis commander priorities file
+void ChassisArbiter::chassisCommandCallback(
+                     const autorally_msgs::chassisCommandConstPtr& msg)
+{
+  boost::mutex::scoped_lock lock(mutex_);
+  std::map<std::string, autorally_msgs::chassisCommand>::iterator mapIt;
+  if((mapIt = chassisCommands_.find(msg->sender)) == chassisCommands_.end())
+  {
+    ROS_ERROR_STREAM(name_ << ": Unknown controller " <<
+                     msg->sender <<
+                     " attempting to control chassis, please add entry " <<
+                     " to chassisCommandPriorities.yaml");
+  } else
+  {
+    mapIt->second = *msg;
+  }
+}
+
+void ChassisArbiter::runstopCallback(const autorally_msgs::runstopConstPtr& msg)
+{
+  boost::mutex::scoped_lock lock(mutex_);
+  runstops_[msg->sender] = *msg;
+}
+
+ros::Time ChassisArbiter::arbitrate(const ros::Time& currentTime, autorally_msgs::chassisState& state)
+{
+  ros::Time throttleStamp;
+
+  state.steeringCommander = "";
+  state.steering = 0.0;
+
+  state.throttleCommander = "";
+  state.throttle = 0.0;
+
+  state.frontBrakeCommander = "";
+  state.frontBrake = 0.0;
+
+  boost::mutex::scoped_lock lock(mutex_);
+
+  //check if motion is enabled (all runstop message runstopMotionEnabled = true)
+  if(runstops_.empty())
+  {
+    state.runstopMotionEnabled = false;
+  } else
+  {
+    state.runstopMotionEnabled = true;
+    int validRunstopCount = 0;
+    for(auto& runstop : runstops_)
+    {
+      if(currentTime-runstop.second.header.stamp < runstopMaxAge_)
+      {
+        ++validRunstopCount;
+        if(runstop.second.motionEnabled == 0)
+        {
+          state.runstopMotionEnabled = false;
+          state.throttleCommander = "runstop";
+        }
+      }
+    }
+    if(validRunstopCount == 0)
+    {
+      state.runstopMotionEnabled = false;
+      state.throttleCommander = "runstop";
+      state.throttle = 0.0;
+    }
+  }
+
+  //find highest priority (lowest value) command message for each actuator across all valid actuator commands
+  for(auto & vecIt : chassisCommandPriorities_)
+  {
+    const autorally_msgs::chassisCommand& command = chassisCommands_[vecIt.id];
+    if( currentTime-command.header.stamp < chassisCommandMaxAge_)
+    {
+      //valid throttle commands are on [-1,1], only set throttle value if runstop is enabled
+      if(state.throttleCommander.empty() && state.runstopMotionEnabled &&
+         command.throttle <= 1.0 &&
+         command.throttle >= -1.0)
+      {
+        state.throttleCommander = command.sender;
+        state.throttle = command.throttle;
+        throttleStamp = command.header.stamp;
+      }
+
+      //valid steeringBrake commands are on [-1,1]
+      if(state.steeringCommander.empty() &&
+         command.steering <= 1.0 &&
+         command.steering >= -1.0)
+      {
+        state.steeringCommander = command.sender;
+        state.steering = command.steering;
+      }
+
+      //valid frontBrake commands are on [0,1]
+      if(state.frontBrakeCommander.empty() &&
+         command.frontBrake <= 1.0 &&
+         command.frontBrake >= 0.0)
+      {
+        state.frontBrakeCommander = command.sender;
+        state.frontBrake = command.frontBrake;
+      }
+    }
+  }
+  return throttleStamp;
+}
+
+void ChassisArbiter::loadChassisCommandPriorities(ros::NodeHandle& nhPvt)
+{
+  //read in chassisCommandPriorities from the parameter server that were loaded by the launch file
+  XmlRpc::XmlRpcValue v;
+  nhPvt.param("chassisCommandProirities", v, v);
+  std::map<std::string, XmlRpc::XmlRpcValue>::iterator mapIt;
+  for(mapIt = v.begin(); mapIt != v.end(); mapIt++)
+  {
+    if(mapIt->second.getType() == XmlRpc::XmlRpcValue::TypeInt)
+    {
+      //add entry in priority queue and command map
+      priorityEntry toAdd;
+      toAdd.id = mapIt->first;
+      toAdd.priority = static_cast<int>(mapIt->second);
+      chassisCommandPriorities_.push_back(toAdd);
+      chassisCommands_[mapIt->first] = autorally_msgs::chassisCommand();
+
+    } else
+    {
+      ROS_ERROR_STREAM(name_ << " XmlRpc chassis command priorities formatted incorrectly");
+    }
+  }
+
+  //sort the loaded commanders according to their priority
+  std::sort(chassisCommandPriorities_.begin(),
+            chassisCommandPriorities_.end(),
+            priorityComparator());
+
+  std::vector<priorityEntry>::const_iterator vecIt;
+  for(vecIt = chassisCommandPriorities_.begin();
+      vecIt != chassisCommandPriorities_.end();
+      vecIt++)
+  {
+    ROS_INFO_STREAM(name_ << " loaded commander " << vecIt->id << " with priority " << vecIt->priority);
+  }
+  ROS_INFO_STREAM(name_ << " loaded " <<
+                  chassisCommandPriorities_.size() << " chassis commanders");
+}
+
+}
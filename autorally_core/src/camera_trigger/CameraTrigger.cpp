@@ -39,14 +39,21 @@
 
 #include<boost/lexical_cast.hpp>
 
+#include <cmath>
 #include <numeric>
+#include <vector>
 
 PLUGINLIB_DECLARE_CLASS(autorally_core, CameraTrigger, autorally_core::CameraTrigger, nodelet::Nodelet)
 
 namespace autorally_core
 {
 
-CameraTrigger::CameraTrigger()
+CameraTrigger::CameraTrigger() :
+  m_decoder(cameraTriggerKeys),
+  m_usePps(true),
+  m_lastTriggerSeq(0),
+  m_lastMicros(0),
+  m_microsHigh(0)
 {}
 
 CameraTrigger::~CameraTrigger()
@@ -61,6 +68,9 @@ void CameraTrigger::onInit()
   {
       NODELET_ERROR("CameraTrigger: Could not get all CameraTrigger parameters");
   }
+  m_nhPvt.param("usePps", m_usePps, true);
+
+  m_triggerTimePub = getNodeHandle().advertise<sensor_msgs::TimeReference>("triggerTime", 10);
 
 	m_port.registerDataCallback(boost::bind(&CameraTrigger::triggerDataCallback, this));
 
@@ -74,68 +84,108 @@ void CameraTrigger::onInit()
 
 void CameraTrigger::triggerDataCallback()
 {
-  std::string msg;
-
-  while(findMessage(msg))
+  ros::Time received = ros::Time::now();
+  CameraTriggerData data;
+  size_t offset = 0;
+  unsigned int found;
+  //only called from the serial read thread, so the buffer needs no lock of its own
+  m_messages.clear();
+
+  //only decode while holding the port, publishing would stall the serial read thread
+  m_port.lock();
+  while(m_decoder.next(m_port.m_data, offset, data, found))
   {
-    boost::char_separator<char> seps(":,\n");
-    tokenizer tok(msg, seps);
-    tokenizer::iterator it=tok.begin();
+    m_messages.push_back(std::make_pair(data, found));
+  }
+  m_port.m_data.erase(0, offset);
+  AsciiDecoderStats stats = m_decoder.stats();
+  m_port.unlock();
 
-    while(it!=tok.end())
+  for(size_t i = 0; i < m_messages.size(); ++i)
+  {
+    const CameraTriggerData& message = m_messages[i].first;
+    found = m_messages[i].second;
+    if(found & CameraTriggerData::TRIGGER)
+    {
+      processTrigger(message, received);
+    }
+    if(found & CameraTriggerData::PPS)
     {
-      if(*it == "pps")
-      {
-        if(++it == tok.end()) break;
-        m_port.diag("PPS count", *it);
-        m_port.tick("pps info");
-      } else if(*it == "fps")
-      {
-        if(++it == tok.end()) break;
-        m_port.diag("Actual triggering FPS", *it);
-        m_port.tick("fps info");
-      } else
-      {
-        NODELET_ERROR("CameraTrigger: Bad token %s", it->c_str());
-        m_port.diag_warn("CameraTrigger got a bad token");
-      }
-
-      if(it!=tok.end())
-      {
-        ++it;
-      }
+      m_port.diag("PPS count", std::to_string(message.ppsCount));
+      m_port.tick("pps info");
+    }
+    if(found & CameraTriggerData::FPS)
+    {
+      m_port.diag("Actual triggering FPS", std::to_string(message.fps));
+      m_port.tick("fps info");
+    }
+    if(!found)
+    {
+      m_port.diag_warn("CameraTrigger got a bad message");
     }
   }
+
+  m_port.diag("Bad frames", std::to_string(stats.badFrames));
+  m_port.diag("Bad records", std::to_string(stats.badRecords+stats.unknownKeys));
   m_port.diag("Requested triggering FPS", std::to_string(m_triggerFPS));
 }
 
-bool CameraTrigger::findMessage(std::string& msg)
+void CameraTrigger::processTrigger(const CameraTriggerData& data, const ros::Time& received)
 {
-  m_port.lock();
-  if(m_port.m_data.size() > 10)
+  uint32_t seq = data.triggerSeq;
+  uint32_t trigger = data.triggerUs;
+  uint32_t ppsCount = data.triggerPpsCount;
+  uint32_t pps = data.triggerPpsUs;
+
+  if(m_lastTriggerSeq != 0 && seq > m_lastTriggerSeq+1)
   {
-    //make sure data is framed
-    if(m_port.m_data[0] != '#')
-    {
-      size_t start = m_port.m_data.find("#");
-      m_port.m_data.erase(0, start);
-    }
+    m_port.diag("Dropped trigger messages", std::to_string(seq-m_lastTriggerSeq-1));
+  }
+  m_lastTriggerSeq = seq;
 
-    //try to pull out a full message
-    size_t end = m_port.m_data.find("\r\n");
-    if(end != std::string::npos)
+  //the microcontroller clock is 32 bit us and wraps about every 71 minutes
+  if(trigger < m_lastMicros)
+  {
+    m_microsHigh += (int64_t(1)<<32);
+  }
+  m_lastMicros = trigger;
+  double triggerSec = (m_microsHigh+trigger)*1e-6;
+
+  //map microcontroller time to system time with the smallest transfer delay seen in the last few seconds
+  double offset = received.toSec()-triggerSec;
+  while(!m_clockOffsets.empty() && (m_clockOffsets.back().second >= offset ||
+                                    received.toSec()-m_clockOffsets.front().first > 5.0))
+  {
+    if(m_clockOffsets.back().second >= offset)
     {
-      //std::cout << "Looking at^" << m_port.m_data << "^" << std::endl;
-      //remove # at beginning and trailing \r\n before further processing
-      msg = m_port.m_data.substr(1,end-1);
-      //erase through \r\n at end of message
-      m_port.m_data.erase(0,end+2);
-      m_port.unlock();
-      return true;
+      m_clockOffsets.pop_back();
+    } else
+    {
+      m_clockOffsets.pop_front();
     }
   }
-  m_port.unlock();
-  return false;
+  m_clockOffsets.push_back(std::make_pair(received.toSec(), offset));
+
+  sensor_msgs::TimeReferencePtr triggerTime(new sensor_msgs::TimeReference);
+  triggerTime->header.stamp = received;
+  triggerTime->header.frame_id = "cameraTrigger";
+
+  double estimate = triggerSec+m_clockOffsets.front().second;
+  //unsigned subtraction is correct across wraparound
+  double sincePps = static_cast<uint32_t>(trigger-pps)*1e-6;
+  if(m_usePps && ppsCount > 0 && sincePps < 1.1)
+  {
+    //the pps edge is the whole system second closest to when it must have happened
+    triggerTime->time_ref = ros::Time(std::floor(estimate-sincePps+0.5)+sincePps);
+    triggerTime->source = "pps";
+  } else
+  {
+    triggerTime->time_ref = ros::Time(estimate);
+    triggerTime->source = "serial";
+  }
+  m_triggerTimePub.publish(triggerTime);
+  m_port.diag("Trigger time source", triggerTime->source);
+  m_port.tick("Trigger time");
 }
 
 void CameraTrigger::configCallback(const camera_trigger_paramsConfig &config, uint32_t /*level*/)
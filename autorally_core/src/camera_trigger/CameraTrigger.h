@@ -42,16 +42,20 @@
 #include <ros/time.h>
 #include <nodelet/nodelet.h>
 #include <dynamic_reconfigure/server.h>
+#include <sensor_msgs/TimeReference.h>
 
 #include <autorally_core/SerialInterfaceThreaded.h>
+#include <autorally_core/AsciiProtocols.h>
 #include <autorally_msgs/wheelSpeeds.h>
 #include <autorally_msgs/chassisCommand.h>
 #include <autorally_core/camera_trigger_paramsConfig.h>
 
-#include <boost/tokenizer.hpp>
 
 #include <stdio.h>
+#include <stdint.h>
 #include <string>
+#include <deque>
+#include <vector>
 
 namespace autorally_core
 {
@@ -61,6 +65,10 @@ namespace autorally_core
  *  "CameraTrigger/CameraTrigger.h"
  *  @brief Interacts with the microcontroller used to trigger the cameras
  *
+ *  Every trigger pulse is published as a sensor_msgs::TimeReference on triggerTime, with time_ref set to the
+ *  rising edge of the pulse in system time. When the GPS PPS signal is connected, the edge is placed relative to
+ *  the most recent pulse, which is assumed to fall on a whole second of the (chrony disciplined) system clock.
+ *  Otherwise the microcontroller clock is mapped to system time with the smallest observed transfer delay.
  */
 class CameraTrigger : public nodelet::Nodelet
 {
@@ -79,22 +87,31 @@ class CameraTrigger : public nodelet::Nodelet
    ///< Dynamic Reconfigure server used for changing the triggering rate on the fly
   dynamic_reconfigure::Server<camera_trigger_paramsConfig> m_dynReconfigServer;
   SerialInterfaceThreaded m_port; ///<Serial port for arduino data
+  AsciiDecoder<CameraTriggerData> m_decoder; ///< Decoder for messages from the microcontroller
+  std::vector<std::pair<CameraTriggerData, unsigned int> > m_messages; ///< Messages decoded in one callback with
+                                                                      ///< their found fields, reused so the
+                                                                      ///< read thread does not allocate
   int m_triggerFPS; ///< Frame rate for the cameras to be triggered
+  ros::Publisher m_triggerTimePub; ///< Publisher for the time of each trigger pulse
+  bool m_usePps; ///< If trigger times should be aligned to PPS when it is available
+  uint32_t m_lastTriggerSeq; ///< Sequence number of the most recent trigger pulse
+  uint32_t m_lastMicros; ///< Most recent microcontroller clock value, to detect wraparound
+  int64_t m_microsHigh; ///< Accumulated wraparounds of the microcontroller clock, in us
+  std::deque<std::pair<double, double> > m_clockOffsets; ///< Recent (receive time, system - microcontroller clock)
+                                                         ///< pairs used when PPS is unavailable
 
-   ///< tokenizer used to parse data received from microcontroller
-  typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
   
   /**
-   * @brief Process incoming data stream to pull out complete message strings
-   * @return bool if a complete message string was found and processed
+   * @brief Decode every complete message received from the microcontroller
    */
   void triggerDataCallback();
   
   /**
-   * @brief Process incoming data stream to pull out complete message strings
-   * @return bool if a complete message string was found and processed
-   */  
-  bool findMessage(std::string& msg);
+   * @brief Publish the system time of a trigger pulse
+   * @param data decoded message holding the trigger values
+   * @param received time the message was read from the port
+   */
+  void processTrigger(const CameraTriggerData& data, const ros::Time& received);
 
   /**
    * @brief Callback triggered when a new message is received from dynamic reconfigure srever
@@ -0,0 +1,120 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TriggerRestamp.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Restamps camera images with the time their trigger pulse fired
+ *
+ * @details Contains TriggerRestamp class implementation
+ ***********************************************/
+#include "TriggerRestamp.h"
+
+#include <cmath>
+
+#include <pluginlib/class_list_macros.h>
+
+PLUGINLIB_DECLARE_CLASS(autorally_core, TriggerRestamp, autorally_core::TriggerRestamp, nodelet::Nodelet)
+
+namespace autorally_core
+{
+
+TriggerRestamp::TriggerRestamp() :
+  m_transferDelay(0.0),
+  m_delayGain(0.05),
+  m_matchWindow(0.0),
+  m_unmatched(0)
+{}
+
+TriggerRestamp::~TriggerRestamp()
+{}
+
+void TriggerRestamp::onInit()
+{
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+
+  double fps;
+  nhPvt.param("transferDelay", m_transferDelay, 0.02);
+  nhPvt.param("delayGain", m_delayGain, 0.05);
+  nhPvt.param("fps", fps, 40.0);
+  m_matchWindow = 0.5/fps;
+
+  m_it.reset(new image_transport::ImageTransport(nh));
+  m_cameraPub = m_it->advertiseCamera("image_restamped", 1);
+  m_triggerTimeSub = nh.subscribe("triggerTime", 100, &TriggerRestamp::triggerTimeCallback, this);
+  m_cameraSub = m_it->subscribeCamera("image", 1, &TriggerRestamp::imageCallback, this);
+}
+
+void TriggerRestamp::triggerTimeCallback(const sensor_msgs::TimeReferenceConstPtr& msg)
+{
+  boost::mutex::scoped_lock lock(m_triggerMutex);
+  m_triggerTimes.push_back(msg->time_ref);
+  //a second of triggers is far more than any camera's transfer delay
+  while(m_triggerTimes.size() > 1 && (m_triggerTimes.back()-m_triggerTimes.front()).toSec() > 1.0)
+  {
+    m_triggerTimes.pop_front();
+  }
+}
+
+void TriggerRestamp::imageCallback(const sensor_msgs::ImageConstPtr& image,
+                                   const sensor_msgs::CameraInfoConstPtr& info)
+{
+  sensor_msgs::ImagePtr restamped(new sensor_msgs::Image(*image));
+  sensor_msgs::CameraInfoPtr restampedInfo(new sensor_msgs::CameraInfo(*info));
+
+  {
+    boost::mutex::scoped_lock lock(m_triggerMutex);
+    ros::Time expected = image->header.stamp-ros::Duration(m_transferDelay);
+    double best = m_matchWindow;
+    std::deque<ros::Time>::const_iterator match = m_triggerTimes.end();
+    for(std::deque<ros::Time>::const_iterator it = m_triggerTimes.begin(); it != m_triggerTimes.end(); ++it)
+    {
+      double diff = std::fabs((*it-expected).toSec());
+      if(diff < best)
+      {
+        best = diff;
+        match = it;
+      }
+    }
+
+    if(match != m_triggerTimes.end())
+    {
+      restamped->header.stamp = *match;
+      m_transferDelay += m_delayGain*((image->header.stamp-*match).toSec()-m_transferDelay);
+    } else
+    {
+      ++m_unmatched;
+      NODELET_WARN_THROTTLE(1.0, "TriggerRestamp: no trigger for image at %f, %d unmatched so far",
+                            image->header.stamp.toSec(), m_unmatched);
+    }
+  }
+
+  restampedInfo->header.stamp = restamped->header.stamp;
+  m_cameraPub.publish(restamped, restampedInfo);
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file TriggerRestamp.h
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Restamps camera images with the time their trigger pulse fired
+ *
+ * @details This file contains the TriggerRestamp class definition
+ ***********************************************/
+#ifndef TRIGGER_RESTAMP
+#define TRIGGER_RESTAMP
+
+#include <deque>
+
+#include <boost/thread/mutex.hpp>
+
+#include <ros/ros.h>
+#include <nodelet/nodelet.h>
+#include <image_transport/image_transport.h>
+#include <sensor_msgs/TimeReference.h>
+
+namespace autorally_core
+{
+
+/**
+ *  @class TriggerRestamp TriggerRestamp.h
+ *  "camera_trigger/TriggerRestamp.h"
+ *  @brief Replaces the receive time stamp of camera images with the exposure time reported by CameraTrigger
+ *
+ *  Each image is matched to the trigger pulse closest to its receive time minus the camera's transfer delay. The
+ *  delay is learned from the matched pairs, starting from transferDelay. An image with no trigger within half a
+ *  frame period of its expected exposure time is published with its original stamp. Run one instance per camera,
+ *  cameras triggered by the same pulse get identical stamps.
+ *
+ *  Subscribes to image (and its camera_info) and triggerTime, publishes image_restamped and its camera_info.
+ */
+class TriggerRestamp : public nodelet::Nodelet
+{
+ public:
+  TriggerRestamp();
+  ~TriggerRestamp();
+
+  virtual void onInit();
+
+ private:
+  boost::shared_ptr<image_transport::ImageTransport> m_it;
+  image_transport::CameraSubscriber m_cameraSub; ///< Incoming images
+  image_transport::CameraPublisher m_cameraPub; ///< Restamped images
+  ros::Subscriber m_triggerTimeSub; ///< Trigger pulse times from CameraTrigger
+
+  boost::mutex m_triggerMutex; ///< Protects m_triggerTimes and m_transferDelay
+  std::deque<ros::Time> m_triggerTimes; ///< Recent trigger pulse times, oldest first
+  double m_transferDelay; ///< Estimated time from trigger to image receipt in s
+  double m_delayGain; ///< Weight of each new match in m_transferDelay
+  double m_matchWindow; ///< Largest difference in s between expected and trigger time for a match
+  int m_unmatched; ///< Images published without a matching trigger
+
+  /**
+   * @brief Callback for trigger times
+   * @param msg time of a trigger pulse in time_ref
+   */
+  void triggerTimeCallback(const sensor_msgs::TimeReferenceConstPtr& msg);
+
+  /**
+   * @brief Callback for images, publishes the restamped copy
+   * @param image incoming image
+   * @param info camera info for the image
+   */
+  void imageCallback(const sensor_msgs::ImageConstPtr& image, const sensor_msgs::CameraInfoConstPtr& info);
+};
+
+}
+#endif //TRIGGER_RESTAMP
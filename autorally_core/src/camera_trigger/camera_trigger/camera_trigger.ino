@@ -13,13 +13,19 @@
 #include <avr/interrupt.h>
 
 int triggerPin = 3; ///< Pin number on the Arduino Micro used to trigger the cameras
+int ppsPin = 2; ///< Pin number on the Arduino Micro the GPS PPS output is connected to
 int triggerFPS = 40; ///< default trigger rate
 
 unsigned long time; ///< Time that the last message was published
 unsigned long elapsed; ///< Calculated elapsed time since last transmission
 
-unsigned long pps; ///< Time that last pps message was recived
-int ppsCount=0; ///< count of received pps pulses
+volatile unsigned long pps; ///< Time in us that last pps pulse was recived
+volatile unsigned long ppsCount=0; ///< count of received pps pulses
+volatile unsigned long triggerTime; ///< Time in us of the most recent trigger rising edge
+volatile unsigned long triggerPps; ///< Time in us of the pps pulse preceding the most recent trigger
+volatile unsigned long triggerPpsCount; ///< ppsCount when the most recent trigger fired
+volatile unsigned long triggerSeq=0; ///< Count of trigger rising edges
+unsigned long sentSeq=0; ///< Most recent trigger sequence number sent to the computer
 float dataPublishPeriod = 500; ///< Period for data to be sent back to computer
 
 /**
@@ -28,9 +34,10 @@ float dataPublishPeriod = 500; ///< Period for data to be sent back to computer
 void setup()
 {
   pinMode(triggerPin, OUTPUT);
+  pinMode(ppsPin, INPUT);
   configureTriggerTimers();
   //attach all interrupt for incoming pps
-  attachInterrupt(digitalPinToInterrupt(triggerPin), int0, RISING);
+  attachInterrupt(digitalPinToInterrupt(ppsPin), int0, RISING);
    
   time = 0;
   pps = 0;
@@ -56,6 +63,28 @@ void loop()
         configureTriggerTimers();
       }
   }
+  //report every trigger as #trg:seq,triggerUs,ppsCount,ppsUs so the computer can timestamp each frame
+  if(sentSeq != triggerSeq)
+  {
+    unsigned long seq, trigger, ppsAtTrigger, ppsCountAtTrigger;
+    cli();
+    seq = triggerSeq;
+    trigger = triggerTime;
+    ppsAtTrigger = triggerPps;
+    ppsCountAtTrigger = triggerPpsCount;
+    sei();
+    sentSeq = seq;
+
+    Serial.print("#trg:");
+    Serial.print(seq);
+    Serial.print(",");
+    Serial.print(trigger);
+    Serial.print(",");
+    Serial.print(ppsCountAtTrigger);
+    Serial.print(",");
+    Serial.println(ppsAtTrigger);
+  }
+
   elapsed = millis()-time;
   if(elapsed >= dataPublishPeriod)
   {
@@ -93,15 +122,23 @@ void configureTriggerTimers()
  */
 ISR(TIMER3_COMPA_vect)
 {
+  if(!digitalRead(triggerPin))
+  {
+    //rising edge starts the exposure
+    triggerTime = micros();
+    triggerPps = pps;
+    triggerPpsCount = ppsCount;
+    ++triggerSeq;
+  }
   digitalWrite(triggerPin, !digitalRead(triggerPin));
 }
 
 /**
-* @brief Interrupt service routine 0 (for incoming pps signal). Currently doesn't do anything
+* @brief Interrupt service routine 0 (for incoming pps signal), records when the pulse arrived
 */
 void int0()
 {
-  pps = millis();
+  pps = micros();
   ++ppsCount;
 }
 
@@ -0,0 +1,257 @@
+#!/usr/bin/env python
+# Software License Agreement (BSD License)
+# Copyright (c) 2026, Georgia Institute of Technology
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+## @package estimatorSweep
+#
+#  Offline tuning of the ImuGpsEstimator noise and geometry parameters. Every
+#  configuration in a sweep spec is run against the same recorded bag by an
+#  independent estimator instance, each with its own ROS master, and as many
+#  instances run at once as there are cores. Configurations are ranked by position
+#  error against a reference Odometry topic in the bag plus --costWeight times the
+#  estimator's mean optimization time per update in ms.
+#
+#  The spec is yaml. base holds fixed parameters, grid the values to take every
+#  combination of, and random a range [low, high] per parameter sampled log
+#  uniformly samples times for every grid point:
+#
+#    base: {GpsSkip: 1, InvertY: true, InvertZ: true}
+#    grid:
+#      GPSSigma: [0.1, 0.5]
+#    random:
+#      samples: 8
+#      AccelerometerSigma: [1.0e-4, 1.0e-2]
+#      GyroSigma: [1.0e-5, 1.0e-3]
+#
+#  Usage: estimatorSweep.py dataset.bag spec.yaml [--reference /pose_estimate] [--jobs N]
+
+import argparse
+import csv
+import itertools
+import math
+import multiprocessing
+import os
+import random
+import shutil
+import signal
+import socket
+import subprocess
+import tempfile
+import time
+from multiprocessing.pool import ThreadPool
+
+import rosbag
+import yaml
+
+## @param spec parsed sweep spec
+#  @return list of parameter dictionaries, one per configuration
+def expandSpec(spec):
+    base = spec.get('base', {}) or {}
+    grid = spec.get('grid', {}) or {}
+    randomSpec = dict(spec.get('random', {}) or {})
+    samples = int(randomSpec.pop('samples', 1 if randomSpec else 0))
+
+    names = sorted(grid.keys())
+    configs = []
+    for values in itertools.product(*[grid[n] for n in names]):
+        point = dict(base)
+        point.update(zip(names, values))
+        if not randomSpec:
+            configs.append(point)
+            continue
+        for _ in range(samples):
+            config = dict(point)
+            for name, (low, high) in randomSpec.items():
+                config[name] = math.exp(random.uniform(math.log(low), math.log(high)))
+            configs.append(config)
+    return configs
+
+## @return a TCP port that was free when checked
+def freePort():
+    s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    s.bind(('localhost', 0))
+    port = s.getsockname()[1]
+    s.close()
+    return port
+
+## @param procs processes to stop, in order
+def stop(procs):
+    for p in procs:
+        if p.poll() is None:
+            p.send_signal(signal.SIGINT)
+    for p in procs:
+        for _ in range(50):
+            if p.poll() is not None:
+                break
+            time.sleep(0.1)
+        if p.poll() is None:
+            p.kill()
+
+## @param job tuple of (index, config, args)
+#  @return path of the bag recorded from the estimator, or None if the run failed
+#
+#  Runs one estimator instance on a private master while the dataset is played into it.
+def runConfig(job):
+    index, config, args = job
+    workDir = os.path.join(args.workDir, 'config%03d' % index)
+    os.makedirs(workDir)
+    with open(os.path.join(workDir, 'params.yaml'), 'w') as f:
+        yaml.safe_dump(config, f, default_flow_style=False)
+
+    env = dict(os.environ)
+    env['ROS_MASTER_URI'] = 'http://localhost:%d' % freePort()
+    log = open(os.path.join(workDir, 'log.txt'), 'w')
+    procs = []
+    try:
+        procs.append(subprocess.Popen(['rosmaster', '--core', '-p', env['ROS_MASTER_URI'].rsplit(':', 1)[1]],
+                                      env=env, stdout=log, stderr=subprocess.STDOUT))
+        time.sleep(1.0)
+        subprocess.check_call(['rosparam', 'load', os.path.join(workDir, 'params.yaml'), '/gps_imu'],
+                              env=env, stdout=log, stderr=subprocess.STDOUT)
+        subprocess.check_call(['rosparam', 'set', '/gps_imu/FixedInitialPose',
+                               'true' if args.fixedInitialPose else 'false'],
+                              env=env, stdout=log, stderr=subprocess.STDOUT)
+        procs.append(subprocess.Popen(['rosbag', 'record', '-O', os.path.join(workDir, 'output.bag'),
+                                       '/gps_imu/pose', '/diagnostics'],
+                                      env=env, stdout=log, stderr=subprocess.STDOUT))
+        procs.append(subprocess.Popen(['rosrun', 'nodelet', 'nodelet', 'standalone', 'autorally_core/ImuGpsEstimator',
+                                       '__name:=gps_imu',
+                                       '/gps_imu/gps:=' + args.gpsTopic,
+                                       '/gps_imu/imu:=' + args.imuTopic,
+                                       '/gps_imu/filter:=' + args.filterTopic],
+                                      env=env, stdout=log, stderr=subprocess.STDOUT))
+        time.sleep(args.startDelay)
+        subprocess.check_call(['rosbag', 'play', '-q', '-r', str(args.rate), args.bag,
+                               '--topics', args.gpsTopic, args.imuTopic, args.filterTopic],
+                              env=env, stdout=log, stderr=subprocess.STDOUT)
+        time.sleep(2.0)
+    except (OSError, subprocess.CalledProcessError) as e:
+        log.write('estimatorSweep: %s\n' % e)
+        return None
+    finally:
+        # stop the estimator before the recorder so its last output is written
+        stop(procs[::-1])
+        log.close()
+    return os.path.join(workDir, 'output.bag')
+
+## @param bagPath bag to read
+#  @param topic nav_msgs/Odometry topic
+#  @return lists of stamps in s and (x, y, z) positions
+def readPositions(bagPath, topic):
+    stamps, positions = [], []
+    with rosbag.Bag(bagPath) as bag:
+        for _, msg, _ in bag.read_messages(topics=[topic]):
+            p = msg.pose.pose.position
+            stamps.append(msg.header.stamp.to_sec())
+            positions.append((p.x, p.y, p.z))
+    return stamps, positions
+
+## @return position RMSE in m of output against the reference, interpolated to the output stamps
+def positionError(reference, output):
+    refStamps, refPositions = reference
+    outStamps, outPositions = output
+    sq, n, j = 0.0, 0, 0
+    for t, p in zip(outStamps, outPositions):
+        while j+1 < len(refStamps) and refStamps[j+1] < t:
+            j += 1
+        if j+1 >= len(refStamps) or refStamps[j] > t:
+            continue
+        a = (t-refStamps[j]) / max(refStamps[j+1]-refStamps[j], 1e-9)
+        r = [refPositions[j][k] + a*(refPositions[j+1][k]-refPositions[j][k]) for k in range(3)]
+        sq += sum((p[k]-r[k])**2 for k in range(3))
+        n += 1
+    return (math.sqrt(sq/n) if n else float('inf')), n
+
+## @return mean optimization time of every estimator update in ms, from the running totals in its last diagnostics
+def updateTime(bagPath):
+    total, n = 0.0, 0
+    with rosbag.Bag(bagPath) as bag:
+        for _, msg, _ in bag.read_messages(topics=['/diagnostics']):
+            for status in msg.status:
+                values = dict((kv.key, kv.value) for kv in status.values)
+                if 'Update time total (ms)' in values and 'Updates' in values:
+                    total = float(values['Update time total (ms)'])
+                    n = int(values['Updates'])
+    return total/n if n else float('nan')
+
+def main():
+    parser = argparse.ArgumentParser(description='Rank ImuGpsEstimator parameter sets on a recorded dataset')
+    parser.add_argument('bag', help='dataset with gps, imu and reference topics')
+    parser.add_argument('spec', help='yaml sweep spec')
+    parser.add_argument('--reference', default='/pose_estimate', help='nav_msgs/Odometry reference topic in the bag')
+    parser.add_argument('--gpsTopic', default='/gpsRoverStatus')
+    parser.add_argument('--imuTopic', default='/imu/imu')
+    parser.add_argument('--filterTopic', default='/imu/filter')
+    parser.add_argument('--fixedInitialPose', action='store_true')
+    parser.add_argument('--jobs', type=int, default=multiprocessing.cpu_count(), help='concurrent estimator instances')
+    parser.add_argument('--rate', type=float, default=1.0, help='bag playback rate')
+    parser.add_argument('--startDelay', type=float, default=3.0, help='seconds to let each estimator start')
+    parser.add_argument('--seed', type=int, default=0)
+    parser.add_argument('--output', default='estimatorSweep.csv')
+    parser.add_argument('--costWeight', type=float, default=0.01,
+                        help='configurations are ranked by position_rmse_m + costWeight*update_time_ms, '
+                             'so the default trades 1 cm of error for 1 ms per update')
+    parser.add_argument('--keep', action='store_true', help='keep each run\'s bag and log')
+    args = parser.parse_args()
+
+    random.seed(args.seed)
+    with open(args.spec) as f:
+        configs = expandSpec(yaml.safe_load(f))
+    args.workDir = tempfile.mkdtemp(prefix='estimatorSweep')
+    print('Running %d configurations, %d at a time, in %s' % (len(configs), args.jobs, args.workDir))
+
+    reference = readPositions(args.bag, args.reference)
+    pool = ThreadPool(args.jobs)
+    outputs = pool.map(runConfig, [(i, c, args) for i, c in enumerate(configs)])
+    pool.close()
+
+    results = []
+    for i, (config, output) in enumerate(zip(configs, outputs)):
+        if output is None or not os.path.exists(output):
+            print('config%03d failed, see its log' % i)
+            continue
+        rmse, matched = positionError(reference, readPositions(output, '/gps_imu/pose'))
+        cost = updateTime(output)
+        score = rmse
+        if args.costWeight > 0:
+            # a run without timing data can not be shown to be cheap
+            score += args.costWeight*cost if not math.isnan(cost) else float('inf')
+        results.append((score, rmse, cost, matched, i, config))
+    results.sort(key=lambda r: r[0])
+
+    names = sorted(set(k for c in configs for k in c.keys()))
+    with open(args.output, 'w') as f:
+        writer = csv.writer(f)
+        writer.writerow(['rank', 'config', 'score', 'position_rmse_m', 'update_time_ms', 'matched_poses'] + names)
+        for rank, (score, rmse, cost, matched, i, config) in enumerate(results):
+            writer.writerow([rank, i, score, rmse, cost, matched] + [config.get(n, '') for n in names])
+    for rank, (score, rmse, cost, matched, i, config) in enumerate(results[:5]):
+        print('%d: config%03d score %.3f, rmse %.3f m, %.2f ms/update %s' % (rank, i, score, rmse, cost, config))
+    print('Results written to %s' % args.output)
+
+    if not args.keep:
+        shutil.rmtree(args.workDir)
+
+if __name__ == '__main__':
+    main()
@@ -33,6 +33,8 @@
  ***********************************************/
 #include "GPSHemisphere.h"
 
+#include <autorally_core/Trace.h>
+
 #include <time.h>
 
 #include <boost/algorithm/string.hpp>
@@ -43,21 +45,16 @@
 #include <stdio.h>
 #include <vector>
 
+#include <pluginlib/class_list_macros.h>
+
 /**
- * This NMEA GPS Interface program currently for the hemisphere
+ * This NMEA GPS Interface nodelet currently for the hemisphere
  * GPS R320, P303, and P307 Receivers.
  */
-int main(int argc, char **argv)
-{
-  ros::init(argc, argv, "gpsBase");
-  ros::NodeHandle nh;
+PLUGINLIB_DECLARE_CLASS(autorally_core, GPSHemisphere, autorally_core::GPSHemisphere, nodelet::Nodelet)
 
-  GPSHemisphere gpsInterface(nh);
-
-  ros::spin();
-
-  return 0;
-}
+namespace autorally_core
+{
 
 void printMessage(const char* message, int size)
 {
@@ -72,12 +69,16 @@ void printMessage(const std::string &message)
   printMessage(message.c_str(), message.size());
 }
 
-GPSHemisphere::GPSHemisphere(ros::NodeHandle &nh):
-  m_previousCovTime(ros::Time::now()),
-  m_mostRecentRTK(ros::Time::now()),
+GPSHemisphere::GPSHemisphere():
   m_rtkEnabled(true)
+{}
+
+void GPSHemisphere::onInit()
 {
-  std::string nodeName = ros::this_node::getName();
+  ros::NodeHandle nh = getNodeHandle();
+  std::string nodeName = getName();
+  m_previousCovTime = ros::Time::now();
+  m_mostRecentRTK = ros::Time::now();
   std::string mode;
   std::string portPathA = "";
   std::string portPathB = "";
@@ -96,7 +97,7 @@ GPSHemisphere::GPSHemisphere(ros::NodeHandle &nh):
      !nh.getParam(nodeName+"/correctionPort/portPath", portPathB) ||
      !nh.getParam(nodeName+"/statusPositionSource", m_statusPositionSource) )
   {
-    ROS_ERROR("GPSHemisphere: could not find mode or portPaths");
+    NODELET_ERROR("GPSHemisphere: could not find mode or portPaths");
   }
   {
     if(mode == "base")
@@ -318,6 +319,7 @@ void GPSHemisphere::rtcmCorrectionCallback(const std_msgs::ByteMultiArray& msg)
 
 void GPSHemisphere::processGPSMessage(std::string& msg)
 {
+  TraceSpan span("GPSHemisphere::processGPSMessage");
   if(msg.length() == 0)
   {
     ROS_WARN("GPSHemisphere: recieved empty message.");
@@ -410,6 +412,7 @@ void GPSHemisphere::processGPSMessage(std::string& msg)
       return;
     }
 
+    span.setNextId(Trace::id(m_navSatFix.header.stamp));
     m_statusPub.publish(m_navSatFix);
     m_portA.tick("Publishing navSatFix");
   } else if(msgType == "GPGNS")
@@ -538,6 +541,7 @@ void GPSHemisphere::processGPSMessage(std::string& msg)
       return;
     }
 
+    span.setNextId(Trace::id(m_navSatFix.header.stamp));
     m_statusPub.publish(m_navSatFix);
     m_portA.tick("Publishing navSatFix");
   } else if(msgType == ">JRTK")
@@ -1052,3 +1056,5 @@ void GPSHemisphere::updateReferenceLocationCallback(const ros::TimerEvent& /*tim
   }
   return;
 }
+
+}
@@ -44,6 +44,7 @@
 
 #include <ros/ros.h>
 #include <ros/time.h>
+#include <nodelet/nodelet.h>
 
 #include <iostream>
 #include <memory>
@@ -91,20 +92,22 @@
  *
  */
 
- 
-class GPSHemisphere
+namespace autorally_core
+{
+
+class GPSHemisphere : public nodelet::Nodelet
 {
 
  public:
+  GPSHemisphere();
+
+  ~GPSHemisphere();
+
   /**
-   * Constructor reads connection information for each port and connects to the
+   * Reads connection information for each port and connects to the
    * Hemisphere GPS R320, and performs other initialization.
-   * @param nh NodeHandle
-
    */
-  GPSHemisphere(ros::NodeHandle &nh);
-
-  ~GPSHemisphere();
+  virtual void onInit();
 
   /**
    * @brief Timer triggered callback to request RTK status from base station
@@ -219,4 +222,5 @@ class GPSHemisphere
   void processUTC(const std::string& utc, const std::string& source);
   double GetUTC(const std::string& utc);
 };
+}
 #endif //GPS_HEMISPHERE_H_
@@ -32,7 +32,15 @@
  **/
 #include "DiagnosticsEntry.hpp"
 
-DiagnosticsEntry::DiagnosticsEntry()
+#include <cmath>
+
+const double DiagnosticsEntry::WHEEL_TICK = 0.1;
+
+DiagnosticsEntry::DiagnosticsEntry() :
+  m_diagnosticFrequency(1.0),
+  m_view(0),
+  m_wheel(WHEEL_SLOTS),
+  m_wheelPosition(-1)
 {
 	QStringList header;
   header << "Name" << "Hardware ID" << "Message" << "Count";
@@ -84,6 +92,11 @@ void DiagnosticsEntry::newKeyValue(QStandardItem* parent, const diagnostic_msgs:
   newMessage[COUNTCOL]->setEditable(false);
 
   parent->appendRow(newMessage);
+
+  if(newMessage[VALCOL]->data().isValid())
+  {
+    schedule(newMessage[VALCOL], newMessage[VALCOL]->data().toDouble() + 5*m_diagnosticFrequency);
+  }
 }
 
 void DiagnosticsEntry::update(const diagnostic_msgs::DiagnosticArray& msg)
@@ -183,6 +196,11 @@ void DiagnosticsEntry::updateKeyValue(QStandardItem* diagMsg,
         diagMsg->child(i,0)->setBackground(color);
         time = ros::Time::now().toSec();
         diagMsg->child(i,1)->setData(QVariant(time));
+        //pairs that are not stale are already scheduled and rechecked from this time when they come due
+        if(diagMsg->child(i,1)->background() == Qt::magenta)
+        {
+          markFresh(diagMsg->child(i,1));
+        }
       }
 
       //count = diagMsg->child(i,2)->text().toInt(&ok) + 1;
@@ -281,6 +299,12 @@ void DiagnosticsEntry::diagModelDoubleClicked(const QModelIndex& index)
   {
     //remove the row that was clicked on
     QStandardItem* parent = m_model.itemFromIndex(index.parent());
+    QStandardItem* value = parent->child(index.row(), VALCOL);
+    if(value && value->background() == Qt::magenta)
+    {
+      m_staleItems.removeOne(QPersistentModelIndex(value->index()));
+      changeStaleCount(parent, -1);
+    }
     parent->removeRow(index.row());
     parent->setBackground(highestPriorityColor(parent));
 
@@ -292,82 +316,119 @@ void DiagnosticsEntry::diagModelDoubleClicked(const QModelIndex& index)
 
 void DiagnosticsEntry::clearStaleDiag()
 {
-  QStandardItem* node;
-
-  //go through each nodes diagnostics messages
-  for(int i = 0; i < m_model.rowCount(); i++)
+  //removing a row edits m_staleItems, the persistent indexes follow the rows that remain
+  QList<QPersistentModelIndex> stale = m_staleItems;
+  foreach(const QPersistentModelIndex& index, stale)
   {
-    node = m_model.item(i);
-
-    //go through each message
-    for(int j = 0; j < node->rowCount();)
+    if(index.isValid())
     {
-      if(node->child(j,1)->background() == Qt::magenta)
-      {
-        //remove that entry by index
-        diagModelDoubleClicked(node->child(j,1)->index());
-      } else
-      {
-        /*only increment the index if there was nothing removed, otherwise
-          the second of two stale messages in a row will be skipped
-        */
-        j++;
-      }
+      diagModelDoubleClicked(index);
     }
   }
+  m_staleItems.clear();
 }
 
 void DiagnosticsEntry::updateTimes()
 {
-  double time;
-  QStandardItem* node;
-  QStandardItem* child1;
-  bool anyStale = false;
+  double now = ros::Time::now().toSec();
+  double staleAge = 5*m_diagnosticFrequency;
+  long long tick = static_cast<long long>(std::floor(now/WHEEL_TICK));
 
-  for(int i = 0; i < m_model.rowCount(); i++)
+  //after a long gap (or the first call) every slot is due once
+  if(m_wheelPosition < 0 || tick-m_wheelPosition > WHEEL_SLOTS)
   {
-    if( (node = m_model.item(i)) == 0)
-    {
-      ROS_ERROR("Invalid Parent Node");
-    } else
-    {
-      anyStale = false;
-      for(int j = 0; j < node->rowCount(); j++)
-      {
-        //only update the times if the model has time data associated with it
-        //this allows non auto_rally diagnostic messages to be not colored
-        if( (child1 = node->child(j,1)) != 0 &&
-            node->child(j,2) != 0 &&
-            child1->data().isValid())
-        {
-          time = ros::Time::now().toSec()-child1->data().toDouble();
+    m_wheelPosition = tick-WHEEL_SLOTS;
+  }
 
-          //consider message stale if a new one has not been received for a while,
-          //color part of it magenta as well as part of the parent
-          if(time > 5*m_diagnosticFrequency)
-          {
-            child1->setBackground(Qt::magenta);
-            anyStale = true;
-          }
-          else
-          {
-            child1->setBackground(node->child(j,2)->background());
-          }
+  while(m_wheelPosition < tick)
+  {
+    ++m_wheelPosition;
+    QList<StaleEntry> due = m_wheel[m_wheelPosition%WHEEL_SLOTS];
+    m_wheel[m_wheelPosition%WHEEL_SLOTS].clear();
 
-          child1->setText(QString::number(time, 'g', 4));
-        } else //there are no key-value pairs with priority, reset bkgnd color
-        {
-          m_model.item(i,1)->setBackground(m_model.item(i,2)->background());
-        }
+    foreach(const StaleEntry& entry, due)
+    {
+      if(!entry.value.isValid())
+      {
+        continue; //the row was removed
       }
-
-      if(anyStale)
+      QStandardItem* value = m_model.itemFromIndex(entry.value);
+      if(std::floor(entry.deadline/WHEEL_TICK) > m_wheelPosition)
+      {
+        //due on a later turn of the wheel
+        schedule(value, entry.deadline);
+      } else if(now-value->data().toDouble() > staleAge)
       {
-        m_model.item(i,1)->setBackground(Qt::magenta);
+        markStale(value);
       } else
       {
-        m_model.item(i,1)->setBackground(m_model.item(i,2)->background());
+        schedule(value, value->data().toDouble()+staleAge);
       }
     }
   }
+
+  //age text for the rows on screen
+  if(m_view)
+  {
+    int bottom = m_view->viewport()->height();
+    QModelIndex index = m_view->indexAt(QPoint(0, 0));
+    while(index.isValid() && m_view->visualRect(index).top() < bottom)
+    {
+      if(index.parent().isValid())
+      {
+        QStandardItem* value = m_model.itemFromIndex(index.sibling(index.row(), VALCOL));
+        if(value && value->data().isValid())
+        {
+          value->setText(QString::number(now-value->data().toDouble(), 'g', 4));
+        }
+      }
+      index = m_view->indexBelow(index);
+    }
+  }
+}
+
+void DiagnosticsEntry::schedule(QStandardItem* value, const double deadline)
+{
+  long long slot = static_cast<long long>(std::floor(deadline/WHEEL_TICK));
+  if(slot <= m_wheelPosition)
+  {
+    slot = m_wheelPosition+1;
+  }
+
+  StaleEntry entry;
+  entry.value = QPersistentModelIndex(value->index());
+  entry.deadline = deadline;
+  m_wheel[slot%WHEEL_SLOTS].append(entry);
+}
+
+void DiagnosticsEntry::markStale(QStandardItem* value)
+{
+  //color part of it magenta as well as part of the parent
+  value->setBackground(Qt::magenta);
+  m_staleItems.append(QPersistentModelIndex(value->index()));
+  changeStaleCount(value->parent(), 1);
+}
+
+void DiagnosticsEntry::markFresh(QStandardItem* value)
+{
+  QStandardItem* parent = value->parent();
+  value->setBackground(parent->child(value->row(), TIMECOL)->background());
+  m_staleItems.removeOne(QPersistentModelIndex(value->index()));
+  changeStaleCount(parent, -1);
+  schedule(value, value->data().toDouble() + 5*m_diagnosticFrequency);
+}
+
+void DiagnosticsEntry::changeStaleCount(QStandardItem* sender, const int change)
+{
+  int before = sender->data(STALE_COUNT_ROLE).toInt();
+  int after = before+change;
+  sender->setData(after, STALE_COUNT_ROLE);
+
+  if(before == 0 && after > 0)
+  {
+    m_model.item(sender->row(), HWIDCOL)->setBackground(Qt::magenta);
+  } else if(before > 0 && after == 0)
+  {
+    m_model.item(sender->row(), HWIDCOL)->setBackground(m_model.item(sender->row(), MSGCOL)->background());
+  }
 }
@@ -40,12 +40,23 @@
 #include <string>
 
 #include <QtGui/QStandardItem>
+#include <QtGui/QTreeView>
 #include <QtCore/QList>
+#include <QtCore/QPersistentModelIndex>
+#include <QtCore/QVector>
 #include <diagnostic_msgs/DiagnosticArray.h>
 
 /**
  *  @class DiagnosticsEntry DiagnosticsEntry.hpp "ocs/DiagnosticsEntry.hpp"
  *  @brief
+ *
+ *  Key-value pairs with a level are considered stale if not received for 5
+ *  diagnostic periods. Instead of checking every pair on every updateTimes(),
+ *  each pair is scheduled in a timer wheel at the time it would go stale and
+ *  only rechecked when that slot comes up. A pair that was refreshed in the
+ *  meantime is rescheduled from its last update, so a pair costs one wheel
+ *  operation per stale period regardless of how often it is received. The age
+ *  text is only refreshed for rows visible in the view set by setView().
  */
 class DiagnosticsEntry : public QObject {
   Q_OBJECT
@@ -67,6 +78,11 @@ public:
 
   void setDiagnosticFrequency(const double diagFreq) {m_diagnosticFrequency = diagFreq;}
 
+  /**
+  * @brief Set the view showing the model, only its visible rows get their age text updated
+  */
+  void setView(QTreeView* view) {m_view = view;}
+
   /**
   * @brief Generates new entry for a sender (node) of diagnostics messages
   * @param level the message level to covnert to a color
@@ -100,8 +116,26 @@ private:
                        VALCOL = 1,
                        TIMECOL = 2};
 
+  static const int STALE_COUNT_ROLE = Qt::UserRole+2; ///< Number of stale pairs, stored on each sender item
+  static const int WHEEL_SLOTS = 128; ///< Slots in the timer wheel
+  static const double WHEEL_TICK; ///< Time covered by one wheel slot in s
+
+  /**
+   * @struct StaleEntry
+   * @brief A key-value pair scheduled to be checked for staleness
+   */
+  struct StaleEntry
+  {
+    QPersistentModelIndex value; ///< Value item of the pair, invalid once the row is removed
+    double deadline;             ///< When the pair goes stale if not received again
+  };
+
   QStandardItemModel m_model; ///<Model holding diagnostic messages
   double m_diagnosticFrequency;
+  QTreeView* m_view; ///< View showing m_model
+  QVector<QList<StaleEntry> > m_wheel; ///< Pairs scheduled by deadline, WHEEL_TICK per slot
+  long long m_wheelPosition; ///< Last processed wheel tick, -1 before the first updateTimes()
+  QList<QPersistentModelIndex> m_staleItems; ///< Value items currently marked stale
 
   /**
   * @brief Generates new entry for a sender (node) of diagnostics messages
@@ -121,6 +155,26 @@ private:
   * @return QBrush the highest priority message (ERROR > WARN > OK)
   */
   QBrush highestPriorityColor(QStandardItem* item);
+
+  /**
+  * @brief Schedule a value item to be checked for staleness at deadline
+  */
+  void schedule(QStandardItem* value, const double deadline);
+
+  /**
+  * @brief Mark a value item stale, and its sender if it is the first stale pair of the sender
+  */
+  void markStale(QStandardItem* value);
+
+  /**
+  * @brief Clear the stale mark of a value item, and its sender if no stale pairs are left
+  */
+  void markFresh(QStandardItem* value);
+
+  /**
+  * @brief Update the stale count of a sender and its color when it changes between zero and nonzero
+  */
+  void changeStaleCount(QStandardItem* sender, const int change);
 };
 
 #endif /* DIAGNOSTICS_ENTRY_HPP_ */
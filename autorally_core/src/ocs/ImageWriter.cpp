@@ -0,0 +1,165 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**
+ * @file ImageWriter.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief ImageWriter class implementation
+ **/
+#include "ImageWriter.hpp"
+
+#include <QtCore/QDir>
+#include <QtCore/QMutexLocker>
+
+#include <iostream>
+
+ImageWriter::ImageWriter(const int threads, const int maxQueued) :
+  m_maxQueued(maxQueued),
+  m_stopping(false),
+  m_written(0),
+  m_dropped(0),
+  m_failed(0)
+{
+  for(int i = 0; i < threads; ++i)
+  {
+    m_workers.append(new Worker(this));
+    //leave the cores to the GUI and ROS callbacks
+    m_workers.back()->start(QThread::LowPriority);
+  }
+}
+
+ImageWriter::~ImageWriter()
+{
+  m_mutex.lock();
+  m_stopping = true;
+  m_jobAvailable.wakeAll();
+  m_mutex.unlock();
+
+  foreach(Worker* worker, m_workers)
+  {
+    worker->wait();
+    delete worker;
+  }
+}
+
+bool ImageWriter::write(const QImage& image, const QString& directory, const QString& name, const Format format)
+{
+  QMutexLocker lock(&m_mutex);
+  if(m_jobs.size() >= m_maxQueued)
+  {
+    ++m_dropped;
+    return false;
+  }
+
+  Job job;
+  job.image = image;
+  job.directory = directory;
+  job.name = name;
+  job.format = format;
+  m_jobs.enqueue(job);
+  m_jobAvailable.wakeOne();
+  return true;
+}
+
+bool ImageWriter::write(const QPixmap& pixmap, const QString& directory, const QString& name, const Format format)
+{
+  //the conversion is a full copy, so skip it if the frame would be dropped anyway
+  m_mutex.lock();
+  bool full = m_jobs.size() >= m_maxQueued;
+  if(full)
+  {
+    ++m_dropped;
+  }
+  m_mutex.unlock();
+
+  return !full && write(pixmap.toImage(), directory, name, format);
+}
+
+unsigned int ImageWriter::written() const
+{
+  QMutexLocker lock(&m_mutex);
+  return m_written;
+}
+
+unsigned int ImageWriter::dropped() const
+{
+  QMutexLocker lock(&m_mutex);
+  return m_dropped;
+}
+
+unsigned int ImageWriter::failed() const
+{
+  QMutexLocker lock(&m_mutex);
+  return m_failed;
+}
+
+unsigned int ImageWriter::queued() const
+{
+  QMutexLocker lock(&m_mutex);
+  return m_jobs.size();
+}
+
+void ImageWriter::process()
+{
+  m_mutex.lock();
+  while(true)
+  {
+    while(m_jobs.isEmpty() && !m_stopping)
+    {
+      m_jobAvailable.wait(&m_mutex);
+    }
+    if(m_jobs.isEmpty())
+    {
+      break;
+    }
+
+    Job job = m_jobs.dequeue();
+    //created under the lock so no other worker writes into it before it exists
+    if(!m_directories.contains(job.directory))
+    {
+      QDir().mkpath(job.directory);
+      m_directories.insert(job.directory);
+    }
+    m_mutex.unlock();
+
+    QString path = job.directory + "/" + job.name + ((job.format == PPM) ? ".ppm" : ".png");
+    bool saved = job.image.save(path, (job.format == PPM) ? "PPM" : "PNG");
+    if(!saved)
+    {
+      std::cout << "Failed to save image to " << path.toStdString().c_str() << std::endl;
+    }
+
+    m_mutex.lock();
+    if(saved)
+    {
+      ++m_written;
+    } else
+    {
+      ++m_failed;
+    }
+  }
+  m_mutex.unlock();
+}
@@ -0,0 +1,125 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file ImageWriter.hpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Background image file writer for the OCS
+ *
+ * @details This file contains the ImageWriter class
+ ***********************************************/
+#ifndef IMAGE_WRITER_HPP_
+#define IMAGE_WRITER_HPP_
+
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QQueue>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+#include <QtGui/QImage>
+#include <QtGui/QPixmap>
+
+/**
+ *  @class ImageWriter ImageWriter.hpp "ocs/ImageWriter.hpp"
+ *  @brief Saves images to disk on worker threads
+ *
+ *  Images are queued without copying (QImage is implicitly shared) and
+ *  encoded and written by a pool of worker threads, so saving never blocks the
+ *  caller on encoding or disk I/O. The queue is bounded, a frame that arrives
+ *  while it is full is dropped and counted. Queued frames are finished when
+ *  the writer is destroyed.
+ */
+class ImageWriter {
+public:
+  enum Format { PNG = 0, ///< Compressed, slow to encode
+                PPM = 1  ///< Uncompressed, fast to encode
+              };
+
+  /**
+  * @brief Constructor, starts the worker threads
+  * @param threads number of worker threads
+  * @param maxQueued maximum number of frames waiting to be written
+  */
+  ImageWriter(const int threads = 2, const int maxQueued = 30);
+  virtual ~ImageWriter();
+
+  /**
+  * @brief Queue an image to be written to directory/name.<format>
+  * @return bool false if the frame was dropped because the queue is full
+  *
+  * The directory is created if it does not exist.
+  */
+  bool write(const QImage& image, const QString& directory, const QString& name, const Format format);
+
+  /**
+  * @brief Queue a pixmap to be written, it is only converted to an image if there is room in the queue
+  * @note must be called from the GUI thread like any other QPixmap use
+  */
+  bool write(const QPixmap& pixmap, const QString& directory, const QString& name, const Format format);
+
+  unsigned int written() const;
+  unsigned int dropped() const;
+  unsigned int failed() const;
+  unsigned int queued() const;
+
+private:
+  struct Job
+  {
+    QImage image;
+    QString directory;
+    QString name;
+    Format format;
+  };
+
+  class Worker : public QThread {
+  public:
+    Worker(ImageWriter* writer) : m_writer(writer) {}
+  protected:
+    void run() {m_writer->process();}
+  private:
+    ImageWriter* m_writer;
+  };
+
+  mutable QMutex m_mutex; ///< Guards everything below
+  QWaitCondition m_jobAvailable;
+  QQueue<Job> m_jobs;
+  int m_maxQueued;
+  bool m_stopping;
+  QSet<QString> m_directories; ///< Directories already created
+  QList<Worker*> m_workers;
+  unsigned int m_written;
+  unsigned int m_dropped;
+  unsigned int m_failed;
+
+  /**
+  * @brief Worker thread loop, encodes queued images until the writer is stopped and the queue is empty
+  */
+  void process();
+};
+
+#endif /* IMAGE_WRITER_HPP_ */
@@ -0,0 +1,184 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**
+ * @file MinMaxBuffer.cpp
+ * @date October 18, 2026
+ * @brief Implementation of the strip chart history buffer
+ **/
+#include "MinMaxBuffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+MinMaxBuffer::MinMaxBuffer(const size_t capacity, const size_t levels, const size_t factor) :
+  m_levels(std::max<size_t>(levels, 1)),
+  m_factor(std::max<size_t>(factor, 2))
+{
+  for(size_t i = 0; i < m_levels.size(); ++i)
+  {
+    m_levels[i].buckets.resize(std::max<size_t>(capacity, 1));
+  }
+  clear();
+}
+
+void MinMaxBuffer::clear()
+{
+  for(size_t i = 0; i < m_levels.size(); ++i)
+  {
+    m_levels[i].head = 0;
+    m_levels[i].size = 0;
+    m_levels[i].dropped = false;
+    m_levels[i].pendingCount = 0;
+  }
+  m_lastTime = 0.0;
+  m_lastValue = 0.0;
+}
+
+void MinMaxBuffer::add(const double time, const double value)
+{
+  //keep every level sorted by time so queries can search it
+  Bucket sample;
+  sample.time = (empty() || time > m_lastTime) ? time : m_lastTime;
+  sample.min = value;
+  sample.max = value;
+  m_lastTime = sample.time;
+  m_lastValue = value;
+  push(0, sample);
+}
+
+void MinMaxBuffer::push(const size_t level, const Bucket& bucket)
+{
+  Level& l = m_levels[level];
+  if(l.size < l.buckets.size())
+  {
+    l.buckets[(l.head+l.size)%l.buckets.size()] = bucket;
+    ++l.size;
+  } else
+  {
+    l.buckets[l.head] = bucket;
+    l.head = (l.head+1)%l.buckets.size();
+    l.dropped = true;
+  }
+
+  if(level+1 < m_levels.size())
+  {
+    Level& up = m_levels[level+1];
+    if(up.pendingCount == 0)
+    {
+      up.pending = bucket;
+    } else
+    {
+      up.pending.min = std::min(up.pending.min, bucket.min);
+      up.pending.max = std::max(up.pending.max, bucket.max);
+    }
+
+    if(++up.pendingCount == m_factor)
+    {
+      up.pendingCount = 0;
+      push(level+1, up.pending);
+    }
+  }
+}
+
+size_t MinMaxBuffer::lowerBound(const Level& level, const double time) const
+{
+  size_t low = 0;
+  size_t high = level.size;
+  while(low < high)
+  {
+    size_t mid = (low+high)/2;
+    if(level.at(mid).time < time)
+    {
+      low = mid+1;
+    } else
+    {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+void MinMaxBuffer::query(const double start, const double end, std::vector<Column>& columns) const
+{
+  for(size_t i = 0; i < columns.size(); ++i)
+  {
+    columns[i].valid = false;
+  }
+  if(columns.empty() || end <= start || empty())
+  {
+    return;
+  }
+
+  //finest level that reaches back to start without more than 2 buckets per column
+  size_t level = 0;
+  for(; level+1 < m_levels.size(); ++level)
+  {
+    const Level& l = m_levels[level];
+    bool covers = !l.dropped || (l.size > 0 && l.at(0).time <= start);
+    if(covers && l.size-lowerBound(l, start) <= 2*columns.size())
+    {
+      break;
+    }
+  }
+
+  const Level& l = m_levels[level];
+  const double width = (end-start)/columns.size();
+  for(size_t i = lowerBound(l, start); i < l.size; ++i)
+  {
+    bin(l.at(i), start, width, columns);
+  }
+  //samples newer than the last completed bucket are still pending in this and finer levels
+  for(size_t i = level; i > 0; --i)
+  {
+    if(m_levels[i].pendingCount > 0)
+    {
+      bin(m_levels[i].pending, start, width, columns);
+    }
+  }
+}
+
+void MinMaxBuffer::bin(const Bucket& bucket, const double start, const double width,
+                       std::vector<Column>& columns) const
+{
+  if(bucket.time < start || bucket.time > start+width*columns.size())
+  {
+    return;
+  }
+  //the span includes its end so the newest sample shows in the last column
+  size_t index = std::min(static_cast<size_t>(std::floor((bucket.time-start)/width)), columns.size()-1);
+
+  Column& c = columns[index];
+  if(!c.valid)
+  {
+    c.valid = true;
+    c.min = bucket.min;
+    c.max = bucket.max;
+  } else
+  {
+    c.min = std::min(c.min, bucket.min);
+    c.max = std::max(c.max, bucket.max);
+  }
+}
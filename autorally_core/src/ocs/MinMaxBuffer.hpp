@@ -0,0 +1,128 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file MinMaxBuffer.hpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Fixed memory multi-resolution history of one signal
+ *
+ * @details This file contains the MinMaxBuffer class
+ ***********************************************/
+#ifndef MIN_MAX_BUFFER_HPP_
+#define MIN_MAX_BUFFER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ *  @class MinMaxBuffer MinMaxBuffer.hpp "ocs/MinMaxBuffer.hpp"
+ *  @brief Decimating min/max ring buffers for strip charts
+ *
+ *  Samples are kept in a stack of ring buffers. The first level holds raw
+ *  samples, each level above it holds buckets with the min and max of factor
+ *  buckets of the level below. Every level has the same capacity, so memory is
+ *  fixed while the coarsest level reaches back capacity*factor^(levels-1)
+ *  samples. A query reads the finest level that covers the requested span
+ *  with at most two buckets per output column, so its cost depends on the
+ *  number of columns, not on the number of samples in the span.
+ */
+class MinMaxBuffer {
+public:
+  struct Bucket
+  {
+    double time; ///< Time of the first sample in the bucket
+    double min;
+    double max;
+  };
+
+  struct Column
+  {
+    bool valid;  ///< If any samples fell in the column
+    double min;
+    double max;
+  };
+
+  /**
+  * @param capacity buckets kept in each level
+  * @param levels number of resolutions
+  * @param factor buckets of a level merged into one bucket of the next level
+  */
+  MinMaxBuffer(const size_t capacity = 1024, const size_t levels = 6, const size_t factor = 4);
+
+  /**
+  * @brief Add a sample. Samples older than the newest one are stored at the newest time
+  * @param time sample time in seconds
+  * @param value sample value
+  */
+  void add(const double time, const double value);
+
+  void clear();
+
+  bool empty() const {return m_levels[0].size == 0;}
+  double lastTime() const {return m_lastTime;}
+  double lastValue() const {return m_lastValue;}
+
+  /**
+  * @brief Min and max of the samples in equal slices of a time span
+  * @param start beginning of the span in seconds
+  * @param end end of the span in seconds, inclusive
+  * @param columns one entry per slice, the size of the vector sets the number of slices
+  */
+  void query(const double start, const double end, std::vector<Column>& columns) const;
+
+private:
+  struct Level
+  {
+    std::vector<Bucket> buckets; ///< Ring of completed buckets
+    size_t head;          ///< Index of the oldest bucket
+    size_t size;          ///< Number of completed buckets
+    bool dropped;         ///< If the ring has overwritten buckets
+    Bucket pending;       ///< Bucket being filled from the level below
+    size_t pendingCount;  ///< Buckets merged into pending
+
+    const Bucket& at(const size_t i) const {return buckets[(head+i)%buckets.size()];}
+  };
+
+  std::vector<Level> m_levels;
+  size_t m_factor;
+  double m_lastTime;
+  double m_lastValue;
+
+  void push(const size_t level, const Bucket& bucket);
+
+  /**
+  * @brief Index of the first completed bucket of a level at or after time
+  */
+  size_t lowerBound(const Level& level, const double time) const;
+
+  /**
+  * @brief Merge a bucket into the column its time falls in, if any
+  */
+  void bin(const Bucket& bucket, const double start, const double width,
+           std::vector<Column>& columns) const;
+};
+
+#endif //MIN_MAX_BUFFER_HPP_
@@ -0,0 +1,203 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**
+ * @file StripChart.cpp
+ * @date October 18, 2026
+ * @brief Implementation of the OCS telemetry plot
+ **/
+#include "StripChart.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtGui/QPainter>
+
+StripChart::StripChart(const QString& title, QWidget* parent) :
+  QWidget(parent),
+  m_title(title),
+  m_window(30.0)
+{
+  setMinimumHeight(120);
+  setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+  //the whole chart is painted every time
+  setAttribute(Qt::WA_OpaquePaintEvent);
+}
+
+int StripChart::addSeries(const QString& name, const QColor& color)
+{
+  Series series;
+  series.name = name;
+  series.color = color;
+  m_series.push_back(series);
+  m_columns.resize(m_series.size());
+  return m_series.size()-1;
+}
+
+void StripChart::add(const int series, const double time, const double value)
+{
+  if(series >= 0 && series < static_cast<int>(m_series.size()) && std::isfinite(value))
+  {
+    m_series[series].buffer.add(time, value);
+  }
+}
+
+void StripChart::setWindow(const double seconds)
+{
+  if(seconds > 0.0)
+  {
+    m_window = seconds;
+    update();
+  }
+}
+
+void StripChart::paintEvent(QPaintEvent* /*event*/)
+{
+  QPainter painter(this);
+  painter.fillRect(rect(), Qt::white);
+  const QFontMetrics metrics = painter.fontMetrics();
+  const int lineHeight = metrics.height();
+  const QRect plot = rect().adjusted(metrics.width("-0000.00")+6, lineHeight+2, -4, -lineHeight-2);
+
+  //legend with the newest value of each series
+  painter.setPen(Qt::black);
+  painter.drawText(4, metrics.ascent()+1, m_title);
+  int x = 4 + metrics.width(m_title) + 16;
+  for(size_t i = 0; i < m_series.size(); ++i)
+  {
+    QString label = m_series[i].name;
+    if(!m_series[i].buffer.empty())
+    {
+      label += QString(" %1").arg(m_series[i].buffer.lastValue(), 0, 'f', 2);
+    }
+    painter.setPen(m_series[i].color);
+    painter.drawText(x, metrics.ascent()+1, label);
+    x += metrics.width(label) + 16;
+  }
+
+  if(plot.width() <= 0 || plot.height() <= 0)
+  {
+    return;
+  }
+
+  //the window ends at the newest sample of any series
+  bool anyData = false;
+  double end = 0.0;
+  for(size_t i = 0; i < m_series.size(); ++i)
+  {
+    if(!m_series[i].buffer.empty())
+    {
+      end = anyData ? std::max(end, m_series[i].buffer.lastTime()) : m_series[i].buffer.lastTime();
+      anyData = true;
+    }
+  }
+
+  double low = 0.0;
+  double high = 0.0;
+  bool anyColumn = false;
+  for(size_t i = 0; i < m_series.size(); ++i)
+  {
+    m_columns[i].resize(plot.width());
+    m_series[i].buffer.query(end-m_window, end, m_columns[i]);
+    for(size_t j = 0; j < m_columns[i].size(); ++j)
+    {
+      const MinMaxBuffer::Column& c = m_columns[i][j];
+      if(c.valid)
+      {
+        low = anyColumn ? std::min(low, c.min) : c.min;
+        high = anyColumn ? std::max(high, c.max) : c.max;
+        anyColumn = true;
+      }
+    }
+  }
+
+  if(high-low < 1e-6)
+  {
+    low -= 0.5;
+    high += 0.5;
+  }
+  double margin = 0.05*(high-low);
+  low -= margin;
+  high += margin;
+  const double scale = plot.height()/(high-low);
+
+  //axes
+  painter.setPen(Qt::lightGray);
+  painter.drawRect(plot.adjusted(0, 0, -1, -1));
+  if(low < 0.0 && high > 0.0)
+  {
+    int zero = plot.bottom() - static_cast<int>((0.0-low)*scale);
+    painter.drawLine(plot.left(), zero, plot.right(), zero);
+  }
+  painter.setPen(Qt::black);
+  painter.drawText(QRect(0, plot.top(), plot.left()-4, lineHeight),
+                   Qt::AlignRight|Qt::AlignTop, QString::number(high, 'f', 2));
+  painter.drawText(QRect(0, plot.bottom()-lineHeight, plot.left()-4, lineHeight),
+                   Qt::AlignRight|Qt::AlignBottom, QString::number(low, 'f', 2));
+  painter.drawText(QRect(plot.left(), plot.bottom()+2, plot.width(), lineHeight),
+                   Qt::AlignLeft|Qt::AlignTop, QString("-%1 s").arg(m_window));
+  painter.drawText(QRect(plot.left(), plot.bottom()+2, plot.width(), lineHeight),
+                   Qt::AlignRight|Qt::AlignTop, tr("now"));
+
+  if(!anyColumn)
+  {
+    return;
+  }
+
+  //one vertical line per column, stretched to meet the previous column so the trace is continuous
+  for(size_t i = 0; i < m_series.size(); ++i)
+  {
+    painter.setPen(m_series[i].color);
+    const std::vector<MinMaxBuffer::Column>& columns = m_columns[i];
+    const MinMaxBuffer::Column* previous = 0;
+    int previousX = 0;
+    for(size_t j = 0; j < columns.size(); ++j)
+    {
+      if(!columns[j].valid)
+      {
+        continue;
+      }
+      double min = columns[j].min;
+      double max = columns[j].max;
+      int columnX = plot.left()+j;
+      if(previous)
+      {
+        min = std::min(min, previous->max);
+        max = std::max(max, previous->min);
+        if(columnX-previousX > 1)
+        {
+          painter.drawLine(previousX, plot.bottom()-static_cast<int>(((previous->min+previous->max)/2.0-low)*scale),
+                           columnX, plot.bottom()-static_cast<int>(((columns[j].min+columns[j].max)/2.0-low)*scale));
+          min = columns[j].min;
+          max = columns[j].max;
+        }
+      }
+      painter.drawLine(columnX, plot.bottom()-static_cast<int>((min-low)*scale),
+                       columnX, plot.bottom()-static_cast<int>((max-low)*scale));
+      previous = &columns[j];
+      previousX = columnX;
+    }
+  }
+}
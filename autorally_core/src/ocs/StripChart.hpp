@@ -0,0 +1,100 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file StripChart.hpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Scrolling telemetry plot for the OCS
+ *
+ * @details This file contains the StripChart class
+ ***********************************************/
+#ifndef STRIP_CHART_HPP_
+#define STRIP_CHART_HPP_
+
+#include <vector>
+
+#include <QtGui/QColor>
+#include <QtGui/QWidget>
+#include <QtCore/QString>
+
+#include "MinMaxBuffer.hpp"
+
+/**
+ *  @class StripChart StripChart.hpp "ocs/StripChart.hpp"
+ *  @brief Plots the recent history of several signals
+ *
+ *  Each series keeps its history in a MinMaxBuffer, and every pixel column is
+ *  drawn as a vertical line from the min to the max of the samples behind it.
+ *  Spikes are never hidden by decimation and a repaint touches a number of
+ *  buckets proportional to the chart width, however long the window is. The
+ *  y axis scales to the data in the window.
+ */
+class StripChart : public QWidget {
+Q_OBJECT
+
+public:
+  StripChart(const QString& title, QWidget* parent = 0);
+
+  /**
+  * @brief Add a signal to the chart
+  * @param name label shown in the legend
+  * @param color color the signal is drawn in
+  * @return index used to add samples to the series
+  */
+  int addSeries(const QString& name, const QColor& color);
+
+  /**
+  * @brief Add a sample to a series, the chart is not repainted until update() is called
+  * @param series index returned by addSeries
+  * @param time sample time in seconds
+  * @param value sample value
+  */
+  void add(const int series, const double time, const double value);
+
+  /**
+  * @brief Set the span of time shown
+  * @param seconds width of the chart in seconds
+  */
+  void setWindow(const double seconds);
+
+protected:
+  void paintEvent(QPaintEvent* event);
+
+private:
+  struct Series
+  {
+    QString name;
+    QColor color;
+    MinMaxBuffer buffer;
+  };
+
+  QString m_title;
+  double m_window; ///< Seconds of history shown
+  std::vector<Series> m_series;
+  std::vector<std::vector<MinMaxBuffer::Column> > m_columns; ///< Query results for each series, reused between paints
+};
+
+#endif //STRIP_CHART_HPP_
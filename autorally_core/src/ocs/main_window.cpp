@@ -34,13 +34,16 @@
 #include <QMessageBox>
 #include <iostream>
 #include "main_window.hpp"
-#include <QDir>
 
 using namespace Qt;
 
 MainWindow::MainWindow(int argc, char** argv, QWidget *parent)
 	: QMainWindow(parent)
 	, qnode(argc,argv)
+	, m_wheelSpeedChart(tr("Wheel speeds"))
+	, m_actuatorChart(tr("Actuators"))
+	, m_estimatorDelayChart(tr("Estimator delays (s)"))
+	, m_escChart(tr("ESC"))
 {
     m_savingImages = false;
     m_saveOneImage = 0;
@@ -56,6 +59,7 @@ MainWindow::MainWindow(int argc, char** argv, QWidget *parent)
 
 	ui.diagMsgsTreeView->setModel(qnode.diagnosticModel());
 	ui.diagMsgsTreeView->header()->setResizeMode(QHeaderView::ResizeToContents);
+  qnode.m_diagModel.setView(ui.diagMsgsTreeView);
 
 	ui.runstopTreeView->setModel(qnode.runstopModel());
   ui.runstopTreeView->header()->setResizeMode(QHeaderView::ResizeToContents);
@@ -63,6 +67,24 @@ MainWindow::MainWindow(int argc, char** argv, QWidget *parent)
   ui.imageMaskTreeView->setModel(qnode.imageMaskModel());
   ui.imageMaskTreeView->header()->setResizeMode(QHeaderView::ResizeToContents);
 
+  m_wheelSpeedChart.addSeries("fl", Qt::red);
+  m_wheelSpeedChart.addSeries("fr", Qt::blue);
+  m_wheelSpeedChart.addSeries("bl", Qt::darkGreen);
+  m_wheelSpeedChart.addSeries("br", Qt::darkMagenta);
+  m_actuatorChart.addSeries("steering", Qt::blue);
+  m_actuatorChart.addSeries("throttle", Qt::darkGreen);
+  m_actuatorChart.addSeries("front brake", Qt::red);
+  m_estimatorDelayChart.addSeries("receive", Qt::blue);
+  m_estimatorDelayChart.addSeries("optimization", Qt::red);
+  m_escSeries["ESC Input Voltage"] = m_escChart.addSeries("V", Qt::blue);
+  m_escSeries["ESC Current"] = m_escChart.addSeries("A", Qt::red);
+  m_escSeries["Output Power %"] = m_escChart.addSeries("power %", Qt::darkGreen);
+  m_escSeries["Temperature"] = m_escChart.addSeries("temp", Qt::darkMagenta);
+  ui.telemetryCharts_layout->addWidget(&m_wheelSpeedChart);
+  ui.telemetryCharts_layout->addWidget(&m_actuatorChart);
+  ui.telemetryCharts_layout->addWidget(&m_estimatorDelayChart);
+  ui.telemetryCharts_layout->addWidget(&m_escChart);
+
 
   QObject::connect(ui.motionControlButton, SIGNAL(clicked(bool)),
                    this, SLOT(enableMotion(bool)));
@@ -78,6 +100,10 @@ MainWindow::MainWindow(int argc, char** argv, QWidget *parent)
                  const autorally_msgs::chassisStateConstPtr&)),
                  this, SLOT(updateActuatorData(
                  const autorally_msgs::chassisStateConstPtr&)));
+  QObject::connect(&qnode, SIGNAL(newEstimatorDelays(double, double, double)),
+                   this, SLOT(updateEstimatorDelays(double, double, double)));
+  QObject::connect(&qnode, SIGNAL(newEscValue(const QString&, double, double)),
+                   this, SLOT(updateEscValue(const QString&, double, double)));
   QObject::connect(&qnode, SIGNAL(newImage1()),
                    this, SLOT(updateImage1()));
   QObject::connect(&qnode, SIGNAL(newImage2()),
@@ -171,6 +197,12 @@ void MainWindow::updateWheelSpeeds(const autorally_msgs::wheelSpeedsConstPtr& ms
   text.sprintf("%.2f", msg->rbSpeed);
   ui.wheelRPS_br->setText(text);
 
+  double time = msg->header.stamp.toSec();
+  m_wheelSpeedChart.add(0, time, msg->lfSpeed);
+  m_wheelSpeedChart.add(1, time, msg->rfSpeed);
+  m_wheelSpeedChart.add(2, time, msg->lbSpeed);
+  m_wheelSpeedChart.add(3, time, msg->rbSpeed);
+
 }
 
 void MainWindow::updateActuatorData(const autorally_msgs::chassisStateConstPtr& msg)
@@ -182,6 +214,39 @@ void MainWindow::updateActuatorData(const autorally_msgs::chassisStateConstPtr&
   ui.steeringSlider->setValue(100*msg->steering);
   ui.throttleBar->setValue(100*msg->throttle);
   ui.frontBrakeBar->setValue(100*msg->frontBrake);
+
+  double time = msg->header.stamp.toSec();
+  m_actuatorChart.add(0, time, msg->steering);
+  m_actuatorChart.add(1, time, msg->throttle);
+  m_actuatorChart.add(2, time, msg->frontBrake);
+}
+
+void MainWindow::updateEstimatorDelays(const double time, const double receiveDelay, const double optimizationLag)
+{
+  m_estimatorDelayChart.add(0, time, receiveDelay);
+  m_estimatorDelayChart.add(1, time, optimizationLag);
+}
+
+void MainWindow::updateEscValue(const QString& key, const double time, const double value)
+{
+  QMap<QString, int>::const_iterator series = m_escSeries.find(key);
+  if(series != m_escSeries.end())
+  {
+    m_escChart.add(series.value(), time, value);
+  }
+}
+
+void MainWindow::on_telemetryWindow_comboBox_currentIndexChanged(int index)
+{
+  //seconds for each entry in telemetryWindow_comboBox
+  static const double windows[] = {10.0, 30.0, 120.0, 600.0, 3600.0};
+  if(index >= 0 && index < static_cast<int>(sizeof(windows)/sizeof(windows[0])))
+  {
+    m_wheelSpeedChart.setWindow(windows[index]);
+    m_actuatorChart.setWindow(windows[index]);
+    m_estimatorDelayChart.setWindow(windows[index]);
+    m_escChart.setWindow(windows[index]);
+  }
 }
 
 void MainWindow::setEnableLabel(QLabel* label, bool enabled)
@@ -229,6 +294,7 @@ void MainWindow::on_pushButton_saveRight_clicked() {
 
 void MainWindow::on_saveImages_button_clicked() {
   ui.saveImagesPath_lineEdit->setEnabled(!ui.saveImages_button->isChecked());
+  ui.saveImagesFormat_comboBox->setEnabled(!ui.saveImages_button->isChecked());
   m_savingImages = ui.saveImages_button->isChecked();
 }
 
@@ -357,6 +423,20 @@ void MainWindow::updateTimeBoxes()
   ros::Time time = ros::Time::now();
   ui.timeSpinBox->setValue(time.toSec());
   ui.elapsedSpinBox->setValue( (time-m_startTime).toSec());
+  ui.saveImagesStatus_label->setText(tr("Saved %1, queued %2, dropped %3, failed %4")
+                                     .arg(m_imageWriter.written())
+                                     .arg(m_imageWriter.queued())
+                                     .arg(m_imageWriter.dropped())
+                                     .arg(m_imageWriter.failed()));
+
+  //charts record all the time but are only drawn while they are shown
+  if(ui.tab_manager->currentWidget() == ui.tab_telemetry)
+  {
+    m_wheelSpeedChart.update();
+    m_actuatorChart.update();
+    m_estimatorDelayChart.update();
+    m_escChart.update();
+  }
   //ROS_INFO("%f",(time-m_startTime).toSec());
 }
 
@@ -366,6 +446,16 @@ void MainWindow::currentTabChanged(const int /*index*/)
             ui.tab_manager->tabText(ui.tab_manager->currentIndex()).toStdString();
 }
 
+void MainWindow::saveImage(const QPixmap& image, const QString& topic)
+{
+  ImageWriter::Format format = (ui.saveImagesFormat_comboBox->currentIndex() == ImageWriter::PPM) ?
+                               ImageWriter::PPM : ImageWriter::PNG;
+  m_imageWriter.write(image,
+                      ui.saveImagesPath_lineEdit->text().append(topic),
+                      QDateTime::currentDateTime().toString("yyyy-MM-dd-hh-mm-ss-zzz"),
+                      format);
+}
+
 void MainWindow::updateImage1()
 {
   int lock_ret = pthread_mutex_lock(&qnode.m_imageMutex);
@@ -437,12 +527,7 @@ void MainWindow::updateImage1()
   
   if(m_savingImages || m_saveOneImage == 1)
   {
-    QDir().mkpath(ui.saveImagesPath_lineEdit->text().append(ui.imageTopics_comboBox->currentText()));
-    QString path = ui.saveImagesPath_lineEdit->text().append(ui.imageTopics_comboBox->currentText()).append(QDateTime::currentDateTime().toString("/yyyy-MM-dd-hh-mm-ss-zzz")).append(".png");
-    if(!qnode.m_firewireImage1.save(path))
-    {
-        std::cout << "Failed to save image to " << path.toStdString().c_str() << std::endl;
-    }
+    saveImage(qnode.m_firewireImage1, ui.imageTopics_comboBox->currentText());
     m_saveOneImage = 0;
   }
   
@@ -533,12 +618,7 @@ void MainWindow::updateImage2()
   
   if(m_savingImages || m_saveOneImage == 2)
   {
-    QDir().mkpath(ui.saveImagesPath_lineEdit->text().append(ui.imageTopics_comboBox->currentText()));
-    QString path = ui.saveImagesPath_lineEdit->text().append(ui.imageTopics_comboBox->currentText()).append(QDateTime::currentDateTime().toString("/yyyy-MM-dd-hh-mm-ss-zzz")).append(".png");
-    if(!qnode.m_firewireImage2.save(path))
-    {
-        std::cout << "Failed to save image to " << path.toStdString().c_str() << std::endl;
-    }
+    saveImage(qnode.m_firewireImage2, ui.imageTopics_comboBox_2->currentText());
     m_saveOneImage = 0;
   }
   
@@ -40,9 +40,12 @@
 #define MAIN_WINDOW_H
 
 #include <QtGui/QMainWindow>
+#include <QtCore/QMap>
 #include <QtCore/QTimer>
 #include "ui_main_window.h"
 #include "qnode.hpp"
+#include "ImageWriter.hpp"
+#include "StripChart.hpp"
 
 /**
  * @class MainWindow main_window.hpp "ocs/main_window.hpp"
@@ -104,6 +107,18 @@ public slots:
   */
   void updateActuatorData(const autorally_msgs::chassisStateConstPtr& msg);
 
+  /**
+  * @brief Add state estimator delays to the telemetry charts
+  */
+  void updateEstimatorDelays(const double time, const double receiveDelay, const double optimizationLag);
+
+  /**
+  * @brief Add a value reported by the ESC to the telemetry charts
+  */
+  void updateEscValue(const QString& key, const double time, const double value);
+
+  void on_telemetryWindow_comboBox_currentIndexChanged(int index);
+
   void setEnableLabel(QLabel* label, bool enabled);
 
   void setControl(bool check);
@@ -143,6 +158,19 @@ private:
   std::string m_progrssBarLevelStyleSheets[3]; ///> List of style sheets for the QProgressBars
   bool m_savingImages;
   int m_saveOneImage;
+  ImageWriter m_imageWriter; ///< Saves camera images without blocking the GUI
+  StripChart m_wheelSpeedChart; ///< Wheel speed history, series in fl, fr, bl, br order
+  StripChart m_actuatorChart; ///< Actuator history, series in steering, throttle, front brake order
+  StripChart m_estimatorDelayChart; ///< State estimator delay history, series in receive, optimization order
+  StripChart m_escChart; ///< ESC data history
+  QMap<QString, int> m_escSeries; ///< Series in m_escChart for each plotted ESC diagnostic key
+
+  /**
+  * @brief Queue an image to be saved in the directory for its topic
+  * @param image the image to save
+  * @param topic image topic the image came from
+  */
+  void saveImage(const QPixmap& image, const QString& topic);
 
   /**
   * @brief Computes a status based on a value and 2 thresholds
@@ -115,6 +115,12 @@ bool QNode::init() {
   imageMask_subscriber = m_nh->subscribe("imageMask", 10,
                                       &QNode::imageMaskCallback,
                                       this);
+  std::string estimatorDelaysTopic;
+  ros::param::param<std::string>("~estimatorDelaysTopic", estimatorDelaysTopic,
+                                 "ImuGpsEstimator/time_delays");
+  estimatorDelays_subscriber = m_nh->subscribe(estimatorDelaysTopic, 10,
+                                      &QNode::estimatorDelaysCallback,
+                                      this);
 
 	m_runstopTimer = m_nh->createTimer(ros::Duration(0.1), &QNode::ssTimerCallback, this);
 //	m_servoCommandTimer = n.createTimer(ros::Duration(0.1), &QNode::ssTimerCallback, this);
@@ -203,6 +209,33 @@ void QNode::setRunstop(const double& speed)
 void QNode::diagStatusCallback(const diagnostic_msgs::DiagnosticArray& msg)
 {
   m_diagModel.update(msg);
+
+  //ESC data from the chassis is only published as diagnostics, pick out the
+  //status that carries it so keys such as Temperature are not mixed up with
+  //other devices
+  for(size_t i = 0; i < msg.status.size(); i++)
+  {
+    const std::vector<diagnostic_msgs::KeyValue>& values = msg.status[i].values;
+    bool esc = false;
+    for(size_t j = 0; j < values.size() && !esc; j++)
+    {
+      esc = (values[j].key == "ESC Input Voltage");
+    }
+    for(size_t j = 0; esc && j < values.size(); j++)
+    {
+      bool ok = false;
+      double value = QString::fromStdString(values[j].value).toDouble(&ok);
+      if(ok)
+      {
+        emit newEscValue(QString::fromStdString(values[j].key), msg.header.stamp.toSec(), value);
+      }
+    }
+  }
+}
+
+void QNode::estimatorDelaysCallback(const geometry_msgs::PointConstPtr& msg)
+{
+  emit newEstimatorDelays(msg->x, msg->y, msg->z);
 }
 
 
@@ -53,6 +53,7 @@
 #include <ros/time.h>
 #include <image_transport/image_transport.h>
 #include <diagnostic_msgs/DiagnosticArray.h>
+#include <geometry_msgs/Point.h>
 #include <autorally_msgs/chassisState.h>
  #include <autorally_msgs/chassisCommand.h>
 #include <autorally_msgs/wheelSpeeds.h>
@@ -154,6 +155,12 @@ public:
   */
   void diagStatusCallback(const diagnostic_msgs::DiagnosticArray& msg);
 
+  /**
+  * @brief Callback for the time delays published by the state estimator
+  * @param msg x is the IMU stamp, y the receive delay and z the optimization lag, in seconds
+  */
+  void estimatorDelaysCallback(const geometry_msgs::PointConstPtr& msg);
+
   /**
   * @brief Callback for new imageMask messages
   * @param msg The new imageMask
@@ -201,6 +208,22 @@ signals:
   */
   void newChassisState(const autorally_msgs::chassisStateConstPtr& msg);
 
+  /**
+  * @brief Signal for the OCS to plot state estimator delays
+  * @param time IMU message time the delays were measured for
+  * @param receiveDelay delay from the IMU stamp to the estimator receiving it
+  * @param optimizationLag delay from the IMU stamp to the latest optimized state
+  */
+  void newEstimatorDelays(const double time, const double receiveDelay, const double optimizationLag);
+
+  /**
+  * @brief Signal for the OCS to plot a value reported by the ESC
+  * @param key diagnostic key of the value
+  * @param time time of the diagnostic message
+  * @param value the new value
+  */
+  void newEscValue(const QString& key, const double time, const double value);
+
   void newImage1();
   void newImage2();
 
@@ -232,6 +255,7 @@ private:
 	//ros::Subscriber wheelSpeeds_subscriber; ///< Subscriber for wheelSpeeds
 	ros::Subscriber diagStatus_subscriber; ///< Subscriber for diagnostics
 	ros::Subscriber chassisState_subscriber; ///< Subscriber for chassisState
+	ros::Subscriber estimatorDelays_subscriber; ///< Subscriber for state estimator time delays
 	ros::Subscriber imageMask_subscriber; ///< Subscriber for imageMask
 	image_transport::Subscriber images_subscriber; ///< Subscriber for images
 	image_transport::Subscriber images_subscriber_2; ///< Subscriber for images
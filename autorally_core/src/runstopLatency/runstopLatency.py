@@ -0,0 +1,281 @@
+#!/usr/bin/env python
+# Software License Agreement (BSD License)
+# Copyright (c) 2026, Georgia Institute of Technology
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+## @package runstopLatency
+#
+#  Measures how long a runstop takes to travel the whole safety chain: run stop box
+#  -> RunStop -> XbeeCoordinator -> radio -> XbeeNode -> /runstop -> AutoRallyChassis
+#  -> chassis serial port. Every serial device is emulated on a pty. The two Xbees
+#  are joined by a loopback emulator that turns each transmit request from one
+#  radio into a receive packet on the other. A constant forward throttle command is
+#  sent to the chassis, the emulated box switches from GREEN to RED at a random
+#  time, and the delay until the chassis port receives a neutral throttle pulse is
+#  recorded for each trial.
+#
+#  Times are taken from the box line being written to its pty. The box firmware
+#  samples its buttons every 50 ms, so a real button press can take up to 50 ms
+#  longer.
+#
+#  Usage: runstopLatency.py [--trials N] [--csv samples.csv]
+
+import argparse
+import csv
+import os
+import random
+import select
+import shutil
+import signal
+import struct
+import subprocess
+import tempfile
+import threading
+import time
+import tty
+
+## must match the throttle center in runstopLatency.launch
+THROTTLE_CENTER = 1500
+## period of the run stop box firmware loop in s
+BOX_PERIOD = 0.05
+BROADCAST = b'\x00\x00\x00\x00\x00\x00\xff\xff'
+
+## @brief Pseudo terminal standing in for a serial device, linked at path
+class Pty:
+    def __init__(self, path):
+        self.master, self.slave = os.openpty()
+        tty.setraw(self.slave)
+        self.path = path
+        os.symlink(os.ttyname(self.slave), path)
+        self.data = b''
+
+    ## @brief append everything waiting on the pty to data
+    def read(self):
+        try:
+            self.data += os.read(self.master, 4096)
+        except OSError:
+            pass
+
+    def write(self, data):
+        os.write(self.master, data)
+
+## @brief Xbee radio in API mode (AP=1) that loops transmissions to a peer
+class Xbee:
+    def __init__(self, path, name, address):
+        self.pty = Pty(path)
+        self.name = name
+        self.address = address
+        self.peer = None
+
+    def frame(self, data):
+        checksum = 0xFF - (sum(bytearray(data)) & 0xFF)
+        return b'\x7e' + struct.pack('>H', len(data)) + data + struct.pack('B', checksum)
+
+    ## @brief handle every complete API frame received from the driver
+    def process(self):
+        self.pty.read()
+        while True:
+            start = self.pty.data.find(b'\x7e')
+            if start < 0:
+                self.pty.data = b''
+                return
+            self.pty.data = self.pty.data[start:]
+            if len(self.pty.data) < 3:
+                return
+            length = struct.unpack('>H', self.pty.data[1:3])[0]
+            if len(self.pty.data) < length+4:
+                return
+            frame = self.pty.data[3:3+length]
+            self.pty.data = self.pty.data[length+4:]
+            self.handle(bytearray(frame))
+
+    def handle(self, frame):
+        if frame[0] == 0x08:
+            #AT command, answer NI with our name and everything else with zero
+            command = bytes(frame[2:4])
+            value = self.name.encode() if command == b'NI' else b'\x00'
+            self.pty.write(self.frame(bytes(bytearray([0x88, frame[1]])) + command + b'\x00' + value))
+        elif frame[0] == 0x10:
+            #transmit request, report success and deliver to the peer as a receive packet
+            self.pty.write(self.frame(bytes(bytearray([0x8B, frame[1], 0xFF, 0xFE, 0x00, 0x00, 0x00]))))
+            options = 0x02 if bytes(frame[2:10]) == BROADCAST else 0x01
+            self.peer.pty.write(self.frame(b'\x90' + self.address + b'\xff\xfe' + bytes(bytearray([options])) +
+                                           bytes(frame[14:])))
+
+## @brief Chassis that records when the throttle pulse it is sent drops to neutral
+class Chassis:
+    def __init__(self, path):
+        self.pty = Pty(path)
+        self.throttle = None
+        self.neutralTime = None
+
+    def process(self, now):
+        self.pty.read()
+        while True:
+            start = self.pty.data.find(b'#s')
+            if start < 0 or len(self.pty.data)-start < 9:
+                self.pty.data = self.pty.data[max(start, 0):] if start >= 0 else b''
+                return
+            message = self.pty.data[start:start+9]
+            self.pty.data = self.pty.data[start+9:]
+            #bytes 4-5 are the throttle pulse width in us, big endian
+            self.throttle = struct.unpack('>h', message[4:6])[0]
+            if self.throttle <= THROTTLE_CENTER and self.neutralTime is None:
+                self.neutralTime = now
+
+## @brief Run stop box, sends its state at the firmware rate and on every change
+class RunstopBox:
+    def __init__(self, path):
+        self.pty = Pty(path)
+        self.state = 'RED'
+        self.lastSend = 0.0
+
+    def set(self, state):
+        self.state = state
+        self.send()
+        return time.time()
+
+    def send(self):
+        self.pty.write(('#estopstate:%s\r\n' % self.state).encode())
+        self.lastSend = time.time()
+
+    def process(self):
+        #the runstop driver never writes, drain anything it might
+        self.pty.read()
+        self.pty.data = b''
+
+    ## @brief resend the current state once per firmware loop
+    def tick(self):
+        if time.time()-self.lastSend >= BOX_PERIOD:
+            self.send()
+
+## @brief Services all emulated devices from one thread
+class Devices(threading.Thread):
+    def __init__(self, deviceDir):
+        threading.Thread.__init__(self)
+        self.daemon = True
+        self.lock = threading.Lock()
+        self.running = True
+        self.box = RunstopBox(os.path.join(deviceDir, 'runStop'))
+        self.coordinator = Xbee(os.path.join(deviceDir, 'xbeeCoordinator'), 'COORDINATOR', b'\x00\x13\xa2\x00\x00\x00\x00\x01')
+        self.node = Xbee(os.path.join(deviceDir, 'xbeeNode'), 'NODE', b'\x00\x13\xa2\x00\x00\x00\x00\x02')
+        self.coordinator.peer = self.node
+        self.node.peer = self.coordinator
+        self.chassis = Chassis(os.path.join(deviceDir, 'chassis'))
+
+    def run(self):
+        fds = {self.box.pty.master: self.box.process,
+               self.coordinator.pty.master: self.coordinator.process,
+               self.node.pty.master: self.node.process,
+               self.chassis.pty.master: lambda: self.chassis.process(time.time())}
+        while self.running:
+            ready, _, _ = select.select(list(fds.keys()), [], [], BOX_PERIOD/5)
+            with self.lock:
+                for fd in ready:
+                    fds[fd]()
+                self.box.tick()
+
+## @param predicate condition to wait for, called with the devices locked
+#  @param timeout s
+#  @return if predicate became true before timeout
+def waitFor(devices, predicate, timeout):
+    end = time.time()+timeout
+    while time.time() < end:
+        with devices.lock:
+            if predicate():
+                return True
+        time.sleep(0.001)
+    return False
+
+## @param samples latencies in s
+#  @param p percentile on [0, 100]
+def percentile(samples, p):
+    ordered = sorted(samples)
+    return ordered[min(len(ordered)-1, int(round(p/100.0*(len(ordered)-1))))]
+
+def main():
+    parser = argparse.ArgumentParser(description='Runstop to chassis latency benchmark')
+    parser.add_argument('--trials', type=int, default=100, help='number of GREEN to RED transitions to time')
+    parser.add_argument('--timeout', type=float, default=2.0, help='s to wait for neutral throttle before a trial fails')
+    parser.add_argument('--csv', help='file to write every sample to')
+    args = parser.parse_args()
+
+    deviceDir = tempfile.mkdtemp(prefix='runstopLatency')
+    devices = Devices(deviceDir)
+    devices.start()
+    launch = subprocess.Popen(['roslaunch', 'autorally_core', 'runstopLatency.launch', 'deviceDir:=' + deviceDir])
+    samples = []
+    failures = 0
+    try:
+        #the coordinator only forwards runstops once its radio reports a node identifier
+        with devices.lock:
+            devices.box.set('GREEN')
+        if not waitFor(devices, lambda: devices.chassis.throttle is not None and
+                       devices.chassis.throttle > THROTTLE_CENTER, 60.0):
+            print('Chassis never received forward throttle, check the launch output')
+            return 1
+
+        for trial in range(args.trials):
+            with devices.lock:
+                devices.box.set('GREEN')
+            #a trial started at neutral would time its own starting state
+            if not waitFor(devices, lambda: devices.chassis.throttle > THROTTLE_CENTER, args.timeout):
+                failures += 1
+                print('trial %d: no forward throttle within %.1f s of re-enabling' % (trial, args.timeout))
+                continue
+            #random press time relative to every periodic process in the chain
+            time.sleep(random.uniform(0.5, 1.5))
+            with devices.lock:
+                devices.chassis.neutralTime = None
+                pressed = devices.box.set('RED')
+            if waitFor(devices, lambda: devices.chassis.neutralTime is not None, args.timeout):
+                samples.append(devices.chassis.neutralTime-pressed)
+                print('trial %d: %.1f ms' % (trial, samples[-1]*1000.0))
+            else:
+                failures += 1
+                print('trial %d: no neutral throttle within %.1f s' % (trial, args.timeout))
+    finally:
+        devices.running = False
+        if launch.poll() is None:
+            launch.send_signal(signal.SIGINT)
+            launch.wait()
+        shutil.rmtree(deviceDir, ignore_errors=True)
+
+    if args.csv:
+        with open(args.csv, 'w') as f:
+            writer = csv.writer(f)
+            writer.writerow(['trial', 'latency_ms'])
+            for i, s in enumerate(samples):
+                writer.writerow([i, s*1000.0])
+
+    if samples:
+        print('%d samples, %d failures' % (len(samples), failures))
+        print('min %.1f ms  median %.1f ms  p95 %.1f ms  p99 %.1f ms  max %.1f ms' %
+              tuple(x*1000.0 for x in (min(samples), percentile(samples, 50), percentile(samples, 95),
+                                       percentile(samples, 99), max(samples))))
+        print('add up to %.0f ms for the run stop box button sampling period' % (BOX_PERIOD*1000.0))
+    return 0 if samples and not failures else 1
+
+if __name__ == '__main__':
+    exit(main())
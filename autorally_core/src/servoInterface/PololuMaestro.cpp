@@ -32,19 +32,31 @@
  *
  ***********************************************/
 
+#include <boost/bind.hpp>
+
 #include <autorally_core/PololuMaestro.h>
 
-PololuMaestro::PololuMaestro()
-{}
+PololuMaestro::PololuMaestro() :
+  m_multipleTargets(false)
+{
+  for(int i = 0; i < MAESTRO_MAX_CHANNELS; i++)
+  {
+    m_targets[i] = 0;
+    m_targetValid[i] = false;
+  }
+}
 
 PololuMaestro::~PololuMaestro()
-{}
+{
+  m_serialPort.clearDataCallback();
+}
 
 void PololuMaestro::init(ros::NodeHandle &nh,
                          const std::string& nodeName,
                          const std::string& port)
 {
-    m_serialPort.init(nh, nodeName, "", "PololuMaestro", port, false);
+    m_serialPort.registerDataCallback(boost::bind(&PololuMaestro::serialDataCallback, this));
+    m_serialPort.init(nh, nodeName, "", "PololuMaestro", port, true);
 }
 
 void PololuMaestro::setTarget(const unsigned char channel, const unsigned char target)
@@ -82,53 +94,169 @@ void PololuMaestro::setTargetMS(const unsigned char channel, const unsigned int
   }
 }
 
-unsigned short PololuMaestro::getTarget(unsigned char channel)
+void PololuMaestro::setTargetsMS(const unsigned char* channels, const unsigned int* targets, const unsigned int count)
+{
+  if(count == 0)
+  {
+    return;
+  }
+
+  bool consecutive = true;
+  for(unsigned int i = 1; i < count; i++)
+  {
+    consecutive = consecutive && (channels[i] == channels[0]+i);
+  }
+
+  unsigned char command[4*MAESTRO_MAX_CHANNELS];
+  unsigned int length = 0;
+  if(m_multipleTargets && consecutive && count > 1)
+  {
+    command[length++] = 0x9F; // Command byte: Set Multiple Targets.
+    command[length++] = count; // Number of targets.
+    command[length++] = channels[0]; // First channel number.
+    for(unsigned int i = 0; i < count; i++)
+    {
+      command[length++] = targets[i]&0x7F;
+      command[length++] = (targets[i]>>7) & 0x7F;
+    }
+  } else
+  {
+    for(unsigned int i = 0; i < count && i < MAESTRO_MAX_CHANNELS; i++)
+    {
+      command[length++] = 0x84; // Command byte: Set Target.
+      command[length++] = channels[i];
+      command[length++] = targets[i]&0x7F;
+      command[length++] = (targets[i]>>7) & 0x7F;
+    }
+  }
+
+  if(m_serialPort.writePort(command, length) != static_cast<int>(length))
+  {
+    m_serialPort.diag_error("Failed to set state");
+  }
+}
+
+void PololuMaestro::requestTarget(const unsigned char channel)
 {
   unsigned char command[2];
-  unsigned char reply[2];
 
   command[0] = 0x90; // Command byte: Get Position.
   command[1] = channel; // First data byte holds channel number.
 
+  //queue the reply before writing so the read thread can never see it first
+  boost::mutex::scoped_lock lock(m_replyMutex);
+  m_pendingReplies.push_back(PendingReply(channel));
   if(m_serialPort.writePort(command, 2) != 2)
   {
-    //ROS_ERROR("Failed to request state");
-    //perror("Pololu: Serial Write error");    
+    m_pendingReplies.pop_back();
     m_serialPort.diag_error("Failed to request state");
-    return 0;
   }
+}
 
-  usleep(10);
-  int r = 0;
-  if( (r = read(m_serialPort.fileDescriptor(), &reply, 2)) != 2)
+bool PololuMaestro::lastTarget(const unsigned char channel, unsigned short& target)
+{
+  boost::mutex::scoped_lock lock(m_replyMutex);
+  if(channel >= MAESTRO_MAX_CHANNELS || !m_targetValid[channel])
   {
-    m_serialPort.diag_error("Error getting channel");
-    //ROS_ERROR("Error getting channel %d : %d", channel, r);
+    return false;
   }
+  target = m_targets[channel];
+  return true;
+}
+
+void PololuMaestro::requestErrors()
+{
+  unsigned char command = 0xA1; // Command byte: Get Errors.
 
-  return reply[0] + (reply[1]<<8);
+  boost::mutex::scoped_lock lock(m_replyMutex);
+  m_pendingReplies.push_back(PendingReply(ERRORS_REPLY));
+  if(m_serialPort.writePort(&command, 1) != 1)
+  {
+    m_pendingReplies.pop_back();
+    ROS_ERROR("PololuMaestro::requestErrors: Failed to get errors");
+  }
 }
 
-void PololuMaestro::getErrors()
+void PololuMaestro::serialDataCallback()
 {
-  unsigned char command = 0xA1;
-  unsigned char reply[2];
-  for(int i = 0; i<2; i++)
+  m_serialPort.lock();
+  boost::mutex::scoped_lock lock(m_replyMutex);
+  //a reply that never arrives would shift every later reply onto the wrong request,
+  //so once any request is overdue the byte stream can't be trusted and is resynced
+  if(!m_pendingReplies.empty() && m_pendingReplies.front().deadline < boost::get_system_time())
+  {
+    m_serialPort.diag_warn("Maestro reply timed out, resyncing");
+    flushReplies();
+  }
+  size_t used = 0;
+  //every reply is two bytes, low byte first
+  while(m_serialPort.m_data.size()-used >= 2 && !m_pendingReplies.empty())
   {
-    reply[i] = 0;
+    unsigned short value = static_cast<unsigned char>(m_serialPort.m_data[used]) +
+                           (static_cast<unsigned char>(m_serialPort.m_data[used+1])<<8);
+    used += 2;
+    int request = m_pendingReplies.front().request;
+    m_pendingReplies.pop_front();
+    if(request == ERRORS_REPLY)
+    {
+      if(value != 0)
+      {
+        m_serialPort.diag_error("Maestro error register:" + std::to_string(value));
+      }
+    } else if(request < MAESTRO_MAX_CHANNELS)
+    {
+      m_targets[request] = value;
+      m_targetValid[request] = true;
+    }
   }
+  //bytes nobody asked for cannot be matched to a request
+  if(m_pendingReplies.empty())
+  {
+    used = m_serialPort.m_data.size();
+  }
+  m_serialPort.m_data.erase(0, used);
+  m_serialPort.unlock();
+  m_replyReceived.notify_all();
+}
 
-  if(m_serialPort.writePort(&command, 1) != 1)
+void PololuMaestro::flushReplies()
+{
+  m_pendingReplies.clear();
+  m_serialPort.m_data.clear();
+}
+
+unsigned short PololuMaestro::getTarget(unsigned char channel)
+{
+  if(channel >= MAESTRO_MAX_CHANNELS)
   {
-    ROS_ERROR("PololuMaestro::getErrors: Failed to get errors");
-    return;
+    return 0;
+  }
+  {
+    boost::mutex::scoped_lock lock(m_replyMutex);
+    m_targetValid[channel] = false;
   }
+  requestTarget(channel);
 
-  if( read(m_serialPort.fileDescriptor(), &reply, 2) != 2)
+  boost::mutex::scoped_lock lock(m_replyMutex);
+  boost::system_time timeout = boost::get_system_time() + boost::posix_time::milliseconds(20);
+  while(!m_targetValid[channel])
   {
-     ROS_ERROR("Error reading errors");
-     m_serialPort.diag_error("Error reading errors");
+    if(!m_replyReceived.timed_wait(lock, timeout))
+    {
+      m_serialPort.diag_error("Error getting channel");
+      //take the locks in the same order as the read thread before dropping the lost request
+      lock.unlock();
+      m_serialPort.lock();
+      lock.lock();
+      flushReplies();
+      m_serialPort.unlock();
+      return 0;
+    }
   }
+  return m_targets[channel];
+}
 
-  ROS_ERROR("Error message:%c %c", reply[0], reply[1]);
+void PololuMaestro::getErrors()
+{
+  requestErrors();
 }
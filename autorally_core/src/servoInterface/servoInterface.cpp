@@ -46,6 +46,11 @@ namespace autorally_core
 ServoInterface::~ServoInterface()
 {}
 
+namespace
+{
+const char* servoNames[ServoInterface::NUM_SERVOS] = {"throttle", "steering", "frontBrake"};
+}
+
 void ServoInterface::onInit()
 {
   ros::NodeHandle nh = getNodeHandle();
@@ -59,6 +64,10 @@ void ServoInterface::onInit()
   loadServoParams();
   loadServoCommandPriorities();
 
+  std::string controllerType;
+  nhPvt.param<std::string>("controllerType", controllerType, "micro");
+  //the Micro Maestro does not implement Set Multiple Targets
+  m_maestro.setMultipleTargetsSupported(controllerType != "micro");
   m_maestro.init(nh, getName(), port);
   //m_ss.init(nh);
 
@@ -108,7 +117,7 @@ void ServoInterface::chassisCommandCallback(
 
 void ServoInterface::setServos(const ros::TimerEvent&)
 {
-
+  m_batchSize = 0;
   autorally_msgs::chassisStatePtr chassisState(new autorally_msgs::chassisState);
   
   chassisState->steeringCommander = "";
@@ -185,12 +194,12 @@ void ServoInterface::setServos(const ros::TimerEvent&)
   if( (chassisState->runstopMotionEnabled == true && !chassisState->throttleCommander.empty()) ||
        chassisState->runstopMotionEnabled == false)
   {
-    setServo("throttle", chassisState->throttle);
+    setServo(THROTTLE, chassisState->throttle);
   }
 
   if(!chassisState->steeringCommander.empty())
   {
-    setServo("steering", chassisState->steering);
+    setServo(STEERING, chassisState->steering);
   } else
   {
     chassisState->steering = -10.0;
@@ -198,13 +207,17 @@ void ServoInterface::setServos(const ros::TimerEvent&)
 
   if(!chassisState->frontBrakeCommander.empty())
   {
-    setServo("frontBrake", std::max(chassisState->frontBrake, 0.0));
+    setServo(FRONT_BRAKE, std::max(chassisState->frontBrake, 0.0));
     chassisState->frontBrake = std::max(chassisState->frontBrake, 0.0);
   } else
   {
     chassisState->frontBrake = -10.0;
   }
 
+  sendServos();
+  //the reply is handled by the serial thread, nonzero errors show up in diagnostics
+  m_maestro.requestErrors();
+
   m_maestro.m_serialPort.diag("steering commander:", chassisState->steeringCommander);
   m_maestro.m_serialPort.diag("throttle commander:", chassisState->throttleCommander);
   if(chassisState->frontBrakeCommander.empty())
@@ -219,42 +232,50 @@ void ServoInterface::setServos(const ros::TimerEvent&)
   m_maestro.m_serialPort.tick("chassisState");
 }
 
-bool ServoInterface::setServo(const std::string& channel, const double target)
+bool ServoInterface::setServo(const Servo servo, const double target)
 {
   if(target > 1.0 || target < -1.0)
   {
-    return false;
     NODELET_WARN_STREAM("Servo value " << target <<
-                        " for channel " << channel <<
+                        " for channel " << servoNames[servo] <<
                         " out of [-1,1] range");
+    return false;
   }
 
-  std::map<std::string, ServoSettings>::const_iterator mapIt;
-  double pos = target;
-  if( (mapIt = m_servoSettings.find(channel)) != m_servoSettings.end())
+  if(!m_servoPresent[servo])
   {
-    if(mapIt->second.reverse)
-    {
-      pos = -pos;
-    }
+    return false;
+  }
 
-    if(pos > 0.0)
-    {
-      pos = mapIt->second.center+pos*(mapIt->second.max-mapIt->second.center);
-    } else if(pos < 0.0)
-    {
-      pos = mapIt->second.center+pos*(mapIt->second.center-mapIt->second.min);
-    } else
-    {
-      pos = mapIt->second.center;
-    }
-    unsigned int val = static_cast<unsigned int>(pos*4);
-    m_maestro.setTargetMS(mapIt->second.port, val);
-    return true;
+  const ServoSettings& settings = m_servos[servo];
+  double pos = settings.reverse ? -target : target;
+  if(pos > 0.0)
+  {
+    pos = settings.center+pos*(settings.max-settings.center);
+  } else if(pos < 0.0)
+  {
+    pos = settings.center+pos*(settings.center-settings.min);
+  } else
+  {
+    pos = settings.center;
   }
 
-//  m_maestro.diag_error("Servo does not exist:"+channel);
-  return false;
+  //keep the batch ordered by channel so consecutive channels can use one compact command
+  unsigned int i = m_batchSize++;
+  for(; i > 0 && m_batchChannels[i-1] > settings.port; i--)
+  {
+    m_batchChannels[i] = m_batchChannels[i-1];
+    m_batchTargets[i] = m_batchTargets[i-1];
+  }
+  m_batchChannels[i] = settings.port;
+  m_batchTargets[i] = static_cast<unsigned int>(pos*4);
+  return true;
+}
+
+void ServoInterface::sendServos()
+{
+  m_maestro.setTargetsMS(m_batchChannels, m_batchTargets, m_batchSize);
+  m_batchSize = 0;
 }
 
 bool ServoInterface::getServo(const std::string& channel, double& position)
@@ -324,6 +345,17 @@ void ServoInterface::loadServoParams()
   }
   NODELET_INFO("ServoInterface: Loaded %lu servos", m_servoSettings.size());
 
+  m_batchSize = 0;
+  for(int i = 0; i < NUM_SERVOS; i++)
+  {
+    std::map<std::string, ServoSettings>::const_iterator mapIt = m_servoSettings.find(servoNames[i]);
+    m_servoPresent[i] = (mapIt != m_servoSettings.end());
+    if(m_servoPresent[i])
+    {
+      m_servos[i] = mapIt->second;
+    }
+  }
+
   if(m_servoSettings.find("frontBrake") != m_servoSettings.end())
   {
     m_brakeSetup.independentFront = true;
@@ -83,6 +83,14 @@ class ServoInterface : public nodelet::Nodelet
     {}
   };
 
+  enum Servo
+  {
+    THROTTLE = 0,
+    STEERING,
+    FRONT_BRAKE,
+    NUM_SERVOS
+  };
+
   ~ServoInterface();
 
   virtual void onInit();
@@ -95,6 +103,11 @@ class ServoInterface : public nodelet::Nodelet
   PololuMaestro m_maestro; ///< Local instance connected to the hardware
 
   std::map<std::string, ServoSettings> m_servoSettings;
+  ServoSettings m_servos[NUM_SERVOS]; ///< Settings of the driven servos, resolved from m_servoSettings at load
+  bool m_servoPresent[NUM_SERVOS]; ///< If each driven servo is configured
+  unsigned char m_batchChannels[NUM_SERVOS]; ///< Channels to send in the current update
+  unsigned int m_batchTargets[NUM_SERVOS]; ///< Targets to send in the current update, in 1/4 ms
+  unsigned int m_batchSize;
   BrakeSetup m_brakeSetup;
   double m_servoCommandMaxAge;
 
@@ -140,12 +153,18 @@ class ServoInterface : public nodelet::Nodelet
   void setServos(const ros::TimerEvent& time);
 
   /**
-   * @brief
+   * @brief Add a servo target to the update sent at the end of setServos
    *
-   * @param channel which channel (throttle or steering) should be set
-   * @param target value to set channel to (-100.0 to 100.0)
+   * @param servo which servo should be set
+   * @param target value to set servo to [-1.0, 1.0]
    */
-  bool setServo(const std::string &channel, const double target);
+  bool setServo(const Servo servo, const double target);
+
+  /**
+   * @brief Send all targets added by setServo in one write, ordered by channel
+   */
+  void sendServos();
+
   bool getServo(const std::string &channel, double& position);
   
   void loadServoParams();
@@ -1,28 +1,29 @@
 #include "XbeeCoordinator.h"
 #include <boost/bind.hpp>
+#include <pluginlib/class_list_macros.h>
 
-int main(int argc, char **argv)
+PLUGINLIB_DECLARE_CLASS(autorally_core, XbeeCoordinator, autorally_core::XbeeCoordinator, nodelet::Nodelet)
+
+namespace autorally_core
 {
-	ros::init(argc, argv, "xbeeCoordinator");
-	ros::NodeHandle nh;
 
-	std::string xbeePort;
-	if(!nh.getParam("xbeeCoordinator/port", xbeePort))
-	{
-		ROS_ERROR("Could not get xbeeCoordinator port name, will exit");
-		return -1;
-	}
+XbeeCoordinator::XbeeCoordinator():
+  m_rtkCount('A')
+{}
 
-	XbeeCoordinator coordinator(nh, xbeePort);
+void XbeeCoordinator::onInit()
+{
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
 
-	ros::spin();
-	return 0;
-}
+  std::string xbeePort;
+  if(!nhPvt.getParam("port", xbeePort))
+  {
+    NODELET_ERROR("Could not get xbeeCoordinator port name, will not start");
+    return;
+  }
 
-XbeeCoordinator::XbeeCoordinator(ros::NodeHandle &nh, const std::string& port):
-  m_xbee(nh, port),
-  m_rtkCount('A')
-{
+  m_xbee.init(nh, getName(), xbeePort);
   m_xbee.registerReceiveMessageCallback(boost::bind(&XbeeCoordinator::processXbeeMessage, this, _1, _2, _3, _4) );
 
   m_runstopSubscriber = nh.subscribe("runstop", 1,
@@ -220,8 +221,7 @@ void XbeeCoordinator::processXbeeOdom(const std::string& message, const std::str
 
   if(!m_recOdomPublishers[sender])
   {
-    ros::NodeHandle nh;
-    m_recOdomPublishers[sender] = nh.advertise<nav_msgs::Odometry>
+    m_recOdomPublishers[sender] = getNodeHandle().advertise<nav_msgs::Odometry>
                                       ("/pose_estimate_"+sender, 1);
 
   }
@@ -230,3 +230,5 @@ void XbeeCoordinator::processXbeeOdom(const std::string& message, const std::str
   m_xbee.m_port.tick("/pose_estimate_"+sender);
   m_recOdomPublishers[sender].publish(odom);
 }
+
+}
@@ -14,6 +14,10 @@
 #include <autorally_msgs/runstop.h>
 #include <std_msgs/ByteMultiArray.h>
 #include <nav_msgs/Odometry.h>
+#include <nodelet/nodelet.h>
+
+namespace autorally_core
+{
 
 /**
  *  @class XbeeCoordinator XbeeCoordinator.h
@@ -27,7 +31,7 @@
  *  RTCM3 messages for RTK-enabled gps devices on each robot to use.
  *
  */
-class XbeeCoordinator
+class XbeeCoordinator : public nodelet::Nodelet
 {
   struct RobotState
   {
@@ -70,9 +74,11 @@ class XbeeCoordinator
 
  public:
 
-  XbeeCoordinator(ros::NodeHandle &nh, const std::string& port);
+  XbeeCoordinator();
   ~XbeeCoordinator();
 
+  virtual void onInit();
+
  private:
 
   XbeeInterface m_xbee;  ///< Xbee object that manages sending/receiving data
@@ -111,3 +117,5 @@ class XbeeCoordinator
   double unscaleAndClip(int number, double range, double resolution);
   void processXbeeOdom(const std::string& message, const std::string& sender);
 };
+
+}
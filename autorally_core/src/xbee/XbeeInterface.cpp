@@ -42,12 +42,16 @@ Explicit Rx Indicator (AO=1) 0x91
 #include <sstream>
 #include <numeric>
 
-XbeeInterface::XbeeInterface(ros::NodeHandle &nh, const std::string& port):
-  m_nh(nh),
+XbeeInterface::XbeeInterface():
+  m_frameID(0),
   m_bytesReceived(0),
   m_bytesTransmitted(0),
   m_atResponseFailures(0)
+{}
+
+void XbeeInterface::init(ros::NodeHandle &nh, const std::string& nodeName, const std::string& port)
 {
+  m_nh = nh;
   //Create function pointers to call based on what type of message is
   m_apiFrameFunctions[(char)0x88] = &XbeeInterface::processATCommandResponse;
   m_apiFrameFunctions[(char)0x97] = &XbeeInterface::processRemoteATCommandResponse;
@@ -56,11 +60,10 @@ XbeeInterface::XbeeInterface(ros::NodeHandle &nh, const std::string& port):
   
   std::string frameID;
   std::string diagInfo;
-  std::string nName = ros::this_node::getName();
-  if(!nh.getParam(nName+"/frameID", frameID) ||
-     !nh.getParam(nName+"/diagnosticInfo", diagInfo) )
+  if(!nh.getParam(nodeName+"/frameID", frameID) ||
+     !nh.getParam(nodeName+"/diagnosticInfo", diagInfo) )
   {
-    ROS_ERROR("Could not get all xbee parameters for %s", nName.c_str());
+    ROS_ERROR("Could not get all xbee parameters for %s", nodeName.c_str());
   }
 
   m_frameID = hexToString(&frameID[0])[0];
@@ -74,7 +77,7 @@ XbeeInterface::XbeeInterface(ros::NodeHandle &nh, const std::string& port):
   }
   m_diagCommands[diagInfo.substr(0, space)] = "-";
 
-  m_port.init(nh, ros::this_node::getName(), "", "Xbee Pro 900", port, true);
+  m_port.init(nh, nodeName, "", "Xbee Pro 900", port, true);
   m_port.registerDataCallback(
                     boost::bind(&XbeeInterface::xbeeDataCallback, this));
 
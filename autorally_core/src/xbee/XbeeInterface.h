@@ -43,16 +43,19 @@ class XbeeInterface
                        const std::string &data,
                        const bool broadcast)> m_receiveMessageCallback;
 
+  XbeeInterface();
+  ~XbeeInterface();
+
   /**
-   * @brief XbeeInterface constructor
+   * @brief Initialize the XbeeInterface
    * @param nh NodeHandle used to register stuff
+   * @param nodeName name of the node, used to look up Xbee parameters
    * @param port name of the xbee
    *
    * Connects to the specified serial device, sets up diagnostics, starts
    * polling timers, verifies startup configuration of Xbee
    */
-  XbeeInterface(ros::NodeHandle &nh, const std::string& port);
-  ~XbeeInterface();
+  void init(ros::NodeHandle &nh, const std::string& nodeName, const std::string& port);
 
   /**
    * @brief Set a function pointer to call to process a newly received message
@@ -10,40 +10,34 @@
 
 #include "XbeeNode.h"
 #include <boost/bind.hpp>
+#include <pluginlib/class_list_macros.h>
 
-int main(int argc, char **argv)
-{
-
-	ros::init(argc, argv, "xbeeNode");
-	ros::NodeHandle nh;
-
-	std::string xbeePort;
+PLUGINLIB_DECLARE_CLASS(autorally_core, XbeeNode, autorally_core::XbeeNode, nodelet::Nodelet)
 
-	if(!nh.getParam("xbeeNode/port", xbeePort))
-	{
-		ROS_ERROR("Could not get xbeeNode parameters");
-		return -1;
-	}
-
-	XbeeNode coordinator(nh, xbeePort);
-
-	ros::spin();
-	return 0;
-}
+namespace autorally_core
+{
 
-XbeeNode::XbeeNode(ros::NodeHandle &nh, const std::string& port):
-  m_xbee(nh, port),
-  m_nh(nh),
+XbeeNode::XbeeNode():
   m_lastrunstop(0),
   m_lastTargetedrunstop(0),
   m_coordinatorAddress("")
+{}
+
+void XbeeNode::onInit()
 {
-  std::string nName = ros::this_node::getName();
-  int transmitPositionRate;
-  if(!nh.getParam(nName+"/transmitPositionRate", transmitPositionRate))
+  ros::NodeHandle nh = getNodeHandle();
+  ros::NodeHandle nhPvt = getPrivateNodeHandle();
+  m_nh = nh;
+
+  std::string xbeePort;
+  int transmitPositionRate = 0;
+  if(!nhPvt.getParam("port", xbeePort) ||
+     !nhPvt.getParam("transmitPositionRate", transmitPositionRate))
   {
-    ROS_ERROR("Could not get all xbee parameters for %s", nName.c_str());
+    NODELET_ERROR("Could not get all xbee parameters for %s", getName().c_str());
   }
+
+  m_xbee.init(nh, getName(), xbeePort);
  
   //until a runstop is received from rf, it will publish runstops
   //with this name
@@ -363,8 +357,7 @@ void XbeeNode::processXbeeOdom(const std::string& message, const std::string& se
 
   if(!m_recOdomPublishers[sender])
   {
-    ros::NodeHandle nh;
-    m_recOdomPublishers[sender] = nh.advertise<nav_msgs::Odometry>
+    m_recOdomPublishers[sender] = m_nh.advertise<nav_msgs::Odometry>
                                       ("/pose_estimate_"+sender, 1);
 
   }
@@ -374,3 +367,5 @@ void XbeeNode::processXbeeOdom(const std::string& message, const std::string& se
   m_xbee.m_port.tick("/pose_estimate_"+sender);
   m_recOdomPublishers[sender].publish(odom);
 }
+
+}
@@ -14,6 +14,10 @@
 #include <std_msgs/ByteMultiArray.h>
 #include <nav_msgs/Odometry.h>
 #include <autorally_msgs/runstop.h>
+#include <nodelet/nodelet.h>
+
+namespace autorally_core
+{
 
 /**
  *  @class XbeeNode XbeeNode.h
@@ -30,13 +34,15 @@
  *  @todo Maybe add more information to message to coordinator?
  *        (current speed, heading, gps location)
  */
-class XbeeNode
+class XbeeNode : public nodelet::Nodelet
 {
  public:
 
-  XbeeNode(ros::NodeHandle &nh, const std::string& port);
+  XbeeNode();
   ~XbeeNode();
 
+  virtual void onInit();
+
  private:
   struct Rtcm3Packets
   {
@@ -123,3 +129,5 @@ class XbeeNode
   double unscaleAndClip(int number, double range, double resolution);
   void processXbeeOdom(const std::string& message,const std::string& sender);
 };
+
+}
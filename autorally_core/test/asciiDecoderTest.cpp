@@ -0,0 +1,322 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file asciiDecoderTest.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Decoding, fuzz and throughput tests for the Arduino ASCII protocols
+ *
+ ***********************************************/
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <autorally_core/AsciiProtocols.h>
+
+using namespace autorally_core;
+
+namespace
+{
+  std::string arduinoFrame(double lf, double rf, double lb, double rb, int throttle, int steering)
+  {
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "#wheels:%.3f,%.3f,%.3f,%.3f\nrc:%d,%d\r\n", lf, rf, lb, rb, throttle, steering);
+    return buffer;
+  }
+
+  std::string triggerFrame(unsigned long seq, unsigned long us, unsigned long ppsCount, unsigned long ppsUs)
+  {
+    return "#trg:" + std::to_string(seq) + "," + std::to_string(us) + "," + std::to_string(ppsCount) + "," +
+           std::to_string(ppsUs) + "\r\n";
+  }
+
+  /**
+   * @brief Flip, insert and delete random bytes of a valid stream
+   */
+  std::string mutate(const std::string& stream, std::mt19937& rng)
+  {
+    static const char alphabet[] = "#:,\r\n.-0123456789abcdefnRGEYLOW";
+    std::string out = stream;
+    std::uniform_int_distribution<int> op(0, 3);
+    std::uniform_int_distribution<size_t> character(0, sizeof(alphabet)-2);
+    std::uniform_int_distribution<int> byte(0, 255);
+    for(size_t edits = out.size()/20; edits > 0 && !out.empty(); --edits)
+    {
+      size_t position = std::uniform_int_distribution<size_t>(0, out.size()-1)(rng);
+      switch(op(rng))
+      {
+        case 0: out[position] = alphabet[character(rng)]; break;
+        case 1: out.insert(position, 1, alphabet[character(rng)]); break;
+        case 2: out.erase(position, 1); break;
+        default: out[position] = static_cast<char>(byte(rng)); break;
+      }
+    }
+    return out;
+  }
+
+  /**
+   * @brief Feed stream to decoder in random sized chunks, as a serial port would deliver it
+   * @return number of frames decoded
+   */
+  template<typename Message>
+  size_t feed(AsciiDecoder<Message>& decoder, const std::string& stream, std::mt19937& rng)
+  {
+    std::string buffer;
+    size_t frames = 0;
+    size_t sent = 0;
+    Message msg;
+    unsigned int found;
+    while(sent < stream.size())
+    {
+      size_t chunk = std::uniform_int_distribution<size_t>(1, 64)(rng);
+      buffer.append(stream, sent, chunk);
+      sent += chunk;
+      size_t offset = 0;
+      while(decoder.next(buffer, offset, msg, found))
+      {
+        ++frames;
+      }
+      EXPECT_LE(offset, buffer.size());
+      buffer.erase(0, offset);
+      //a partial frame never grows without bound
+      EXPECT_LE(buffer.size(), 256u+64u);
+    }
+    return frames;
+  }
+
+  template<typename Message, size_t N>
+  void benchmark(const char* name, const AsciiKey<Message> (&keys)[N], const std::string& frame)
+  {
+    std::string stream;
+    while(stream.size() < (1u<<20))
+    {
+      stream += frame;
+    }
+    AsciiDecoder<Message> decoder(keys);
+    Message msg;
+    unsigned int found = 0;
+    unsigned int all = 0;
+    const int passes = 20;
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < passes; ++i)
+    {
+      size_t offset = 0;
+      while(decoder.next(stream, offset, msg, found))
+      {
+        all |= found;
+      }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+
+    std::cout << name << " " << decoder.stats().frames/seconds << " frames/s, "
+              << passes*stream.size()/seconds/1e6 << " MB/s" << std::endl;
+    EXPECT_EQ(0u, decoder.stats().badFrames+decoder.stats().badRecords+decoder.stats().unknownKeys);
+    EXPECT_NE(0u, all);
+  }
+}
+
+/**
+  * @test Number formats the Arduinos print
+  */
+TEST(AsciiDecoder, values)
+{
+  const char* text[] = {"12.345", "-0.500", "7", "nan", "1e3", "-2.5E-2", ".5", "0.000"};
+  double expected[] = {12.345, -0.5, 7.0, NAN, 1000.0, -0.025, 0.5, 0.0};
+  for(size_t i = 0; i < sizeof(expected)/sizeof(expected[0]); ++i)
+  {
+    double value;
+    ASSERT_TRUE(parseAsciiValue(text[i], text[i]+std::strlen(text[i]), value)) << text[i];
+    if(std::isnan(expected[i]))
+    {
+      EXPECT_TRUE(std::isnan(value));
+    } else
+    {
+      EXPECT_DOUBLE_EQ(expected[i], value) << text[i];
+    }
+  }
+
+  const char* bad[] = {"", "-", "1.2.3", "1,2", "inf", "ovf", "12a", "e5"};
+  for(size_t i = 0; i < sizeof(bad)/sizeof(bad[0]); ++i)
+  {
+    double value;
+    EXPECT_FALSE(parseAsciiValue(bad[i], bad[i]+std::strlen(bad[i]), value)) << bad[i];
+  }
+
+  unsigned int u = 0;
+  EXPECT_TRUE(parseAsciiValue("4294967295", "4294967295"+10, u));
+  EXPECT_EQ(4294967295u, u);
+  EXPECT_FALSE(parseAsciiValue("4294967296", "4294967296"+10, u));
+  EXPECT_FALSE(parseAsciiValue("-1", "-1"+2, u));
+  int i = 0;
+  EXPECT_TRUE(parseAsciiValue("-2147483648", "-2147483648"+11, i));
+  EXPECT_EQ(-2147483647-1, i);
+}
+
+/**
+  * @test Frames split across reads, garbage between frames and missing records
+  */
+TEST(AsciiDecoder, arduinoOnboard)
+{
+  AsciiDecoder<ArduinoOnboardData> decoder(arduinoOnboardKeys);
+  ArduinoOnboardData data;
+  unsigned int found;
+  size_t offset = 0;
+
+  std::string buffer = "xx#wheels:1.000,2.500,-3.000,nan\nrc:3000,2900\r\n#wheels:1.0,2.0";
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(unsigned(ArduinoOnboardData::WHEELS | ArduinoOnboardData::RC), found);
+  EXPECT_DOUBLE_EQ(1.0, data.lf);
+  EXPECT_DOUBLE_EQ(2.5, data.rf);
+  EXPECT_DOUBLE_EQ(-3.0, data.lb);
+  EXPECT_TRUE(std::isnan(data.rb));
+  EXPECT_DOUBLE_EQ(3000.0, data.rcThrottle);
+  EXPECT_DOUBLE_EQ(2900.0, data.rcSteering);
+  EXPECT_EQ(2u, decoder.stats().droppedBytes);
+
+  //second frame is incomplete and must be left in the buffer
+  EXPECT_FALSE(decoder.next(buffer, offset, data, found));
+  buffer.erase(0, offset);
+  EXPECT_EQ("#wheels:1.0,2.0", buffer);
+
+  offset = 0;
+  buffer += ",3.0\nrc:1,2,3\r\n";
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(0u, found);
+  EXPECT_EQ(2u, decoder.stats().badRecords);
+
+  //a lost terminator drops the cut off frame and keeps the next one
+  buffer = "#wheels:1.0,1.0,#wheels:4.0,4.0,4.0,4.0\nrc:1,2\r\n";
+  offset = 0;
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(unsigned(ArduinoOnboardData::WHEELS | ArduinoOnboardData::RC), found);
+  EXPECT_DOUBLE_EQ(4.0, data.rb);
+  EXPECT_EQ(1u, decoder.stats().badFrames);
+  EXPECT_EQ(buffer.size(), offset);
+}
+
+/**
+  * @test All camera trigger messages, including 32 bit limits
+  */
+TEST(AsciiDecoder, cameraTrigger)
+{
+  AsciiDecoder<CameraTriggerData> decoder(cameraTriggerKeys);
+  CameraTriggerData data;
+  unsigned int found;
+  size_t offset = 0;
+
+  std::string buffer = "#pps:12\r\n#fps:40\r\n" + triggerFrame(7, 4294967295ul, 12, 4294000000ul) + "#foo:1\r\n";
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(unsigned(CameraTriggerData::PPS), found);
+  EXPECT_EQ(12u, data.ppsCount);
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(unsigned(CameraTriggerData::FPS), found);
+  EXPECT_EQ(40u, data.fps);
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(unsigned(CameraTriggerData::TRIGGER), found);
+  EXPECT_EQ(7u, data.triggerSeq);
+  EXPECT_EQ(4294967295u, data.triggerUs);
+  EXPECT_EQ(12u, data.triggerPpsCount);
+  EXPECT_EQ(4294000000u, data.triggerPpsUs);
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(0u, found);
+  EXPECT_EQ(1u, decoder.stats().unknownKeys);
+  EXPECT_FALSE(decoder.next(buffer, offset, data, found));
+}
+
+/**
+  * @test Only exact state names are accepted from the run stop box
+  */
+TEST(AsciiDecoder, runStopBox)
+{
+  AsciiDecoder<RunStopBoxData> decoder(runStopBoxKeys);
+  RunStopBoxData data;
+  unsigned int found;
+  size_t offset = 0;
+
+  std::string buffer = "#estopstate:GREEN\r\n#estopstate:YELLOW\r\n#estopstate:GREENISH\r\n#estopstate:RED\r\n";
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(unsigned(RunStopBoxData::STATE), found);
+  EXPECT_EQ(RunStopBoxData::GREEN, data.state);
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(RunStopBoxData::YELLOW, data.state);
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(0u, found);
+  ASSERT_TRUE(decoder.next(buffer, offset, data, found));
+  EXPECT_EQ(RunStopBoxData::RED, data.state);
+}
+
+/**
+  * @test Randomly corrupted streams never overrun, stall or leave the decoder unable to resync
+  */
+TEST(AsciiDecoder, fuzz)
+{
+  std::mt19937 rng(2026);
+  std::uniform_real_distribution<double> speed(-50.0, 50.0);
+  std::uniform_int_distribution<int> pulse(1800, 4200);
+  std::uniform_int_distribution<unsigned long> word(0, 4294967295ul);
+  const char* states[] = {"RED", "YELLOW", "GREEN"};
+
+  for(int round = 0; round < 200; ++round)
+  {
+    std::string arduino, trigger, runstop;
+    for(int i = 0; i < 50; ++i)
+    {
+      arduino += arduinoFrame(speed(rng), speed(rng), speed(rng), speed(rng), pulse(rng), pulse(rng));
+      trigger += (i%20 == 0) ? "#pps:" + std::to_string(i) + "\r\n" : triggerFrame(word(rng), word(rng), i, word(rng));
+      runstop += std::string("#estopstate:") + states[i%3] + "\r\n";
+    }
+
+    AsciiDecoder<ArduinoOnboardData> arduinoDecoder(arduinoOnboardKeys);
+    AsciiDecoder<CameraTriggerData> triggerDecoder(cameraTriggerKeys);
+    AsciiDecoder<RunStopBoxData> runstopDecoder(runStopBoxKeys);
+    feed(arduinoDecoder, mutate(arduino, rng), rng);
+    feed(triggerDecoder, mutate(trigger, rng), rng);
+    feed(runstopDecoder, mutate(runstop, rng), rng);
+
+    //after any corruption, a clean frame is still decoded
+    EXPECT_EQ(1u, feed(arduinoDecoder, arduinoFrame(1, 2, 3, 4, 3000, 3000), rng));
+    EXPECT_EQ(1u, feed(triggerDecoder, triggerFrame(1, 2, 3, 4), rng));
+    EXPECT_EQ(1u, feed(runstopDecoder, "#estopstate:RED\r\n", rng));
+  }
+}
+
+/**
+  * @test Decoding throughput of each protocol on a clean stream
+  */
+TEST(AsciiDecoder, benchmark)
+{
+  benchmark<ArduinoOnboardData>("ArduinoOnboard", arduinoOnboardKeys,
+                                arduinoFrame(12.345, 12.3, 11.9, 12.0, 3012, 2987));
+  benchmark<CameraTriggerData>("CameraTrigger", cameraTriggerKeys,
+                               triggerFrame(123456, 4012345678ul, 3600, 4011345678ul));
+  benchmark<RunStopBoxData>("RunStop", runStopBoxKeys, "#estopstate:GREEN\r\n");
+}
@@ -0,0 +1,144 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file bicycleModelTest.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Unit tests for BicycleModel
+ *
+ ***********************************************/
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <autorally_core/BicycleModel.h>
+
+using autorally_core::BicycleModel;
+
+/**
+  * @test Throttle accelerates in a straight line, braking stops without rolling backwards
+  */
+TEST(BicycleModel, straight)
+{
+  BicycleModel model;
+  BicycleModel::State s;
+  for(int i = 0; i < 2000; ++i)
+  {
+    model.step(s, 0.0, 0.5, 0.0, 0.001);
+  }
+  EXPECT_GT(s.speed, 3.0);
+  EXPECT_LT(s.speed, 6.0);
+  EXPECT_GT(s.x, 3.0);
+  EXPECT_NEAR(s.y, 0.0, 1e-9);
+  EXPECT_NEAR(s.yaw, 0.0, 1e-9);
+  EXPECT_GT(s.longitudinalAcceleration, 0.0);
+
+  for(int i = 0; i < 5000; ++i)
+  {
+    model.step(s, 0.0, -1.0, 1.0, 0.001);
+  }
+  EXPECT_EQ(s.speed, 0.0);
+  double x = s.x;
+  model.step(s, 0.0, -1.0, 1.0, 0.001);
+  EXPECT_EQ(s.x, x);
+}
+
+/**
+  * @test Full throttle levels off below maxSpeed
+  */
+TEST(BicycleModel, topSpeed)
+{
+  BicycleModel::Params p;
+  p.maxSpeed = 10.0;
+  BicycleModel model(p);
+  BicycleModel::State s;
+  for(int i = 0; i < 60000; ++i)
+  {
+    model.step(s, 0.0, 1.0, 0.0, 0.001);
+  }
+  EXPECT_LT(s.speed, 10.0);
+  EXPECT_GT(s.speed, 8.0);
+}
+
+/**
+  * @test A constant steering command drives a circle of the kinematic radius, positive steering turns right
+  */
+TEST(BicycleModel, turn)
+{
+  BicycleModel::Params p;
+  p.drag = 0.0;
+  BicycleModel model(p);
+  BicycleModel::State s;
+  s.speed = 2.0;
+
+  //let the steering settle, then drive one full circle
+  for(int i = 0; i < 1000; ++i)
+  {
+    model.step(s, 0.5, 0.0, 0.0, 0.001);
+  }
+  EXPECT_NEAR(s.steeringAngle, -0.5*p.maxSteeringAngle, 1e-9);
+  EXPECT_LT(s.yawRate, 0.0);
+
+  double radius = std::sqrt(p.rearAxleToCg*p.rearAxleToCg +
+                            std::pow(p.wheelbase/std::tan(s.steeringAngle), 2));
+  EXPECT_NEAR(s.speed/std::fabs(s.yawRate), radius, 1e-6);
+
+  double x = s.x, y = s.y;
+  double period = 2.0*M_PI/std::fabs(s.yawRate);
+  int steps = static_cast<int>(std::round(period/0.001));
+  for(int i = 0; i < steps; ++i)
+  {
+    model.step(s, 0.5, 0.0, 0.0, 0.001);
+  }
+  EXPECT_NEAR(s.x, x, 0.01);
+  EXPECT_NEAR(s.y, y, 0.01);
+  EXPECT_NEAR(s.lateralAcceleration, s.speed*s.yawRate, 1e-9);
+}
+
+/**
+  * @test Wheels on the outside of a turn and steered wheels turn faster
+  */
+TEST(BicycleModel, wheelSpeeds)
+{
+  BicycleModel model;
+  BicycleModel::State s;
+  s.speed = 5.0;
+
+  BicycleModel::WheelSpeeds w = model.wheelSpeeds(s);
+  EXPECT_DOUBLE_EQ(w.lf, 5.0);
+  EXPECT_DOUBLE_EQ(w.rb, 5.0);
+
+  //turning left
+  for(int i = 0; i < 500; ++i)
+  {
+    model.step(s, -1.0, 0.0, 0.0, 0.001);
+  }
+  w = model.wheelSpeeds(s);
+  EXPECT_GT(s.yawRate, 0.0);
+  EXPECT_GT(w.rf, w.lf);
+  EXPECT_GT(w.rb, w.lb);
+  EXPECT_GT(w.lf, w.lb);
+}
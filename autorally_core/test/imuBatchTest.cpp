@@ -0,0 +1,134 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file imuBatchTest.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Checks ImuBatchIntegrator against gtsam preintegration
+ *
+ ***********************************************/
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <gtsam/navigation/ImuFactor.h>
+
+#include "../src/StateEstimator/ImuBatch.h"
+
+using namespace gtsam;
+using autorally_core::ImuBatch;
+using autorally_core::ImuBatchIntegrator;
+
+namespace
+{
+  const double DT = 0.005;
+
+  /**
+   * @brief Raw samples of a vehicle weaving through turns, in the sensor frame
+   */
+  ImuBatch makeBatch(size_t n)
+  {
+    ImuBatch batch;
+    for (size_t i = 1; i <= n; ++i)
+    {
+      double t = i*DT;
+      batch.push(t, Eigen::Vector3d(1.5*std::sin(0.7*t), -0.8*std::cos(1.3*t), -9.8+0.3*std::sin(4.0*t)),
+                    Eigen::Vector3d(0.1*std::sin(2.0*t), -0.05*std::cos(3.0*t), 0.6*std::sin(0.5*t)));
+    }
+    return batch;
+  }
+}
+
+/**
+  * @test Deltas and prediction match gtsam with an axis flip and nonzero bias
+  */
+TEST(ImuBatch, matchesGtsam)
+{
+  ImuBatch batch = makeBatch(400);
+  Matrix3 axes = Vector3(1.0, -1.0, -1.0).asDiagonal();
+  imuBias::ConstantBias bias(Vector3(0.05, -0.02, 0.1), Vector3(0.003, 0.001, -0.002));
+
+  boost::shared_ptr<PreintegrationParams> params = PreintegrationParams::MakeSharedU(9.8);
+  params->accelerometerCovariance = 1e-3 * I_3x3;
+  params->gyroscopeCovariance = 1e-4 * I_3x3;
+  params->integrationCovariance = 1e-5 * I_3x3;
+  PreintegratedImuMeasurements reference(params, bias);
+  double prev = 0.0;
+  for (size_t i = 0; i < batch.size(); ++i)
+  {
+    reference.integrateMeasurement(axes*Vector3(batch.ax[i], batch.ay[i], batch.az[i]),
+                                   axes*Vector3(batch.gx[i], batch.gy[i], batch.gz[i]), batch.t[i]-prev);
+    prev = batch.t[i];
+  }
+
+  ImuBatchIntegrator integrator;
+  integrator.integrate(batch, 0, 150, 0.0, axes, bias.accelerometer(), bias.gyroscope());
+  integrator.integrate(batch, 150, batch.size(), batch.t[149], axes, bias.accelerometer(), bias.gyroscope());
+
+  EXPECT_NEAR(integrator.deltaT(), reference.deltaTij(), 1e-9);
+  EXPECT_TRUE(assert_equal(Matrix3(reference.deltaRij().matrix()), Matrix3(integrator.deltaR()), 1e-6));
+  EXPECT_TRUE(assert_equal(Vector3(reference.deltaPij()), Vector3(integrator.deltaP()), 1e-4));
+  EXPECT_TRUE(assert_equal(Vector3(reference.deltaVij()), Vector3(integrator.deltaV()), 1e-4));
+
+  NavState state(Rot3::Ypr(0.3, -0.1, 0.05), Point3(1.0, 2.0, 0.5), Vector3(4.0, -1.0, 0.2));
+  NavState expected = reference.predict(state, bias);
+  Matrix3 R;
+  Vector3 p, v;
+  integrator.predict(state.attitude().matrix(), state.position(), state.velocity(), params->n_gravity, R, p, v);
+  EXPECT_TRUE(assert_equal(Matrix3(expected.attitude().matrix()), R, 1e-6));
+  EXPECT_TRUE(assert_equal(Vector3(expected.position()), p, 1e-4));
+  EXPECT_TRUE(assert_equal(Vector3(expected.velocity()), v, 1e-4));
+}
+
+/**
+  * @test Throughput of the batch kernel and of gtsam, one sample at a time
+  */
+TEST(ImuBatch, benchmark)
+{
+  const size_t n = 200000;
+  ImuBatch batch = makeBatch(n);
+  Matrix3 axes = I_3x3;
+
+  auto start = std::chrono::steady_clock::now();
+  ImuBatchIntegrator integrator;
+  integrator.integrate(batch, 0, n, 0.0, axes, Vector3::Zero(), Vector3::Zero());
+  double batchTime = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+
+  PreintegratedImuMeasurements reference(PreintegrationParams::MakeSharedU(9.8), imuBias::ConstantBias());
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n; ++i)
+  {
+    reference.integrateMeasurement(Vector3(batch.ax[i], batch.ay[i], batch.az[i]),
+                                   Vector3(batch.gx[i], batch.gy[i], batch.gz[i]), DT);
+  }
+  double gtsamTime = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+
+  std::cout << "ImuBatchIntegrator " << n/batchTime << " samples/s, gtsam " << n/gtsamTime << " samples/s"
+            << std::endl;
+  EXPECT_NEAR(integrator.deltaT(), n*DT, 1e-6);
+}
@@ -0,0 +1,88 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file staticAlignmentTest.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Checks the static alignment attitude for default and rotated IMU mountings
+ *
+ ***********************************************/
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../src/StateEstimator/StaticAlignment.h"
+
+using namespace gtsam;
+using autorally_core::staticAlignment;
+
+namespace
+{
+  /**
+   * @brief Accelerometer reading at rest for a vehicle attitude, the inverse of the filter path mounting
+   */
+  Vector3 restingAcc(const Rot3& vehicle, const Rot3& bodyRSensor, const Rot3& carENURcarNED)
+  {
+    // sensor attitude in NED = bodyRSensor^T * vehicle * carENURcarNED^T, gravity reaction is -z in NED
+    Matrix3 sensor = bodyRSensor.matrix().transpose() * vehicle.matrix() * carENURcarNED.matrix().transpose();
+    return sensor.transpose() * Vector3(0, 0, -9.81);
+  }
+}
+
+/**
+ * @test With the stateEstimator.launch mounting the result matches levelling the inverted axes directly
+ */
+TEST(StaticAlignment, defaultMounting)
+{
+  Rot3 bodyRSensor = Rot3::RzRyRx(0, M_PI, M_PI/2);
+  Rot3 carENURcarNED = Rot3::RzRyRx(M_PI, 0, 0);
+  Rot3 vehicle = Rot3::Ypr(0.7, 0.05, -0.1);
+
+  Vector3 acc = restingAcc(vehicle, bodyRSensor, carENURcarNED);
+  Rot3 aligned = staticAlignment(acc, 0.7, bodyRSensor, carENURcarNED);
+  EXPECT_TRUE(vehicle.equals(aligned, 1e-9));
+
+  Vector3 body(acc.x(), -acc.y(), -acc.z());
+  Rot3 inverted = Rot3::Ypr(0.7, atan2(-body.x(), sqrt(body.y()*body.y() + body.z()*body.z())),
+                            atan2(body.y(), body.z()));
+  EXPECT_TRUE(inverted.equals(aligned, 1e-9));
+}
+
+/**
+ * @test An IMU yawed and tilted on the vehicle still seeds the vehicle attitude
+ */
+TEST(StaticAlignment, rotatedMounting)
+{
+  Rot3 bodyRSensor = Rot3::RzRyRx(0, M_PI, M_PI/2);
+  Rot3 carENURcarNED = Rot3::RzRyRx(M_PI, 0.2, 1.1);
+  Rot3 vehicle = Rot3::Ypr(-2.3, -0.08, 0.12);
+
+  Vector3 acc = restingAcc(vehicle, bodyRSensor, carENURcarNED);
+  Rot3 aligned = staticAlignment(acc, -2.3, bodyRSensor, carENURcarNED);
+  EXPECT_TRUE(vehicle.equals(aligned, 1e-9));
+  EXPECT_NEAR(aligned.roll(), 0.12, 1e-9);
+  EXPECT_NEAR(aligned.pitch(), -0.08, 1e-9);
+}
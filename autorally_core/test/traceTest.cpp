@@ -0,0 +1,151 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file traceTest.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Unit tests for Trace
+ *
+ ***********************************************/
+#include <gtest/gtest.h>
+
+#include <autorally_core/Trace.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using autorally_core::Trace;
+using autorally_core::TraceSpan;
+
+/**
+  * @test Spans are only recorded while tracing is enabled
+  */
+TEST(Trace, enable)
+{
+  Trace::setEnabled(false);
+  size_t before = Trace::snapshot().size();
+  {
+    TraceSpan span("disabled");
+  }
+  EXPECT_EQ(Trace::snapshot().size(), before);
+
+  Trace::setEnabled(true);
+  {
+    TraceSpan span("enabled", 1);
+    span.setNextId(2);
+  }
+  Trace::setEnabled(false);
+
+  std::vector<Trace::Event> events = Trace::snapshot();
+  ASSERT_EQ(events.size(), before+1);
+  EXPECT_EQ(std::string(events.back().name), "enabled");
+  EXPECT_EQ(events.back().id, 1u);
+  EXPECT_EQ(events.back().nextId, 2u);
+  EXPECT_LE(events.back().start, events.back().end);
+}
+
+/**
+  * @test A full buffer exports the most recent BUFFER_SIZE-1 events of a thread,
+  *       the oldest slot is the one the writer overwrites next
+  */
+TEST(Trace, wrapAround)
+{
+  std::thread writer([]()
+    {
+      for(uint64_t i = 1; i <= 3*Trace::BUFFER_SIZE; ++i)
+      {
+        Trace::record("wrap", i, i+1, i, 0);
+      }
+    });
+  writer.join();
+
+  uint64_t count = 0;
+  uint64_t minId = 0;
+  for(const Trace::Event& e : Trace::snapshot())
+  {
+    if(std::string(e.name) == "wrap")
+    {
+      ++count;
+      minId = (minId == 0) ? e.id : std::min(minId, e.id);
+    }
+  }
+  EXPECT_EQ(count, Trace::BUFFER_SIZE-1);
+  EXPECT_EQ(minId, 2*Trace::BUFFER_SIZE+2);
+}
+
+/**
+  * @test Snapshots taken while another thread records only contain whole events
+  */
+TEST(Trace, concurrentSnapshot)
+{
+  std::atomic<bool> done(false);
+  std::thread writer([&done]()
+    {
+      for(uint64_t i = 1; i <= 20*Trace::BUFFER_SIZE; ++i)
+      {
+        Trace::record("concurrent", i, i, i, i);
+      }
+      done = true;
+    });
+
+  while(!done)
+  {
+    for(const Trace::Event& e : Trace::snapshot())
+    {
+      if(std::string(e.name) == "concurrent")
+      {
+        ASSERT_EQ(e.start, e.id);
+        ASSERT_EQ(e.nextId, e.id);
+      }
+    }
+  }
+  writer.join();
+}
+
+/**
+  * @test Linked spans are exported with matching flow start and finish events
+  */
+TEST(Trace, chromeTrace)
+{
+  std::vector<Trace::Event> events(2);
+  events[0] = {"producer", 1000, 2000, 0, 1476800000123456789ull, 1};
+  events[1] = {"consumer", 3000, 4500, 1476800000123456789ull, 0, 2};
+
+  std::string json = Trace::toChromeTrace(events);
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"producer\""), std::string::npos);
+  EXPECT_NE(json.find("\"ts\":3.000,\"dur\":1.500"), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"s\",\"id\":\"1476800000123456789\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"f\",\"bp\":\"e\",\"id\":\"1476800000123456789\""), std::string::npos);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
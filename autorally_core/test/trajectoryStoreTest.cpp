@@ -0,0 +1,124 @@
+/*
+* Software License Agreement (BSD License)
+* Copyright (c) 2026, Georgia Institute of Technology
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+* this list of conditions and the following disclaimer in the documentation
+* and/or other materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**********************************************
+ * @file trajectoryStoreTest.cpp
+ * @date October 18, 2026
+ * @copyright 2026 Georgia Institute of Technology
+ * @brief Unit tests for TrajectoryStore
+ *
+ ***********************************************/
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <autorally_core/TrajectoryStore.h>
+
+using autorally_core::TrajectoryStore;
+
+namespace
+{
+  TrajectoryStore::State makeState(double t, double x, double yaw, bool optimized = false)
+  {
+    TrajectoryStore::State s;
+    s.stamp = ros::Time(t);
+    s.pose.position.x = x;
+    s.pose.orientation.z = std::sin(yaw/2.0);
+    s.pose.orientation.w = std::cos(yaw/2.0);
+    s.twist.linear.x = x;
+    s.optimized = optimized;
+    return s;
+  }
+}
+
+/**
+  * @test Lookups interpolate between neighbours and fail outside the stored range
+  */
+TEST(TrajectoryStore, lookup)
+{
+  TrajectoryStore store;
+  store.add(makeState(10.0, 0.0, 0.0));
+  store.add(makeState(11.0, 2.0, 1.0));
+
+  TrajectoryStore::State s;
+  EXPECT_FALSE(store.lookup(ros::Time(9.5), s));
+  EXPECT_FALSE(store.lookup(ros::Time(11.5), s));
+
+  ASSERT_TRUE(store.lookup(ros::Time(10.25), s));
+  EXPECT_NEAR(s.pose.position.x, 0.5, 1e-9);
+  EXPECT_NEAR(s.twist.linear.x, 0.5, 1e-9);
+  EXPECT_NEAR(2.0*std::atan2(s.pose.orientation.z, s.pose.orientation.w), 0.25, 1e-9);
+
+  ASSERT_TRUE(store.lookup(ros::Time(11.0), s));
+  EXPECT_NEAR(s.pose.position.x, 2.0, 1e-9);
+}
+
+/**
+  * @test Late optimized states are inserted in order and replace equal stamps
+  */
+TEST(TrajectoryStore, optimizedInsert)
+{
+  TrajectoryStore store;
+  store.add(makeState(1.0, 1.0, 0.0));
+  store.add(makeState(2.0, 2.0, 0.0));
+  store.add(makeState(3.0, 3.0, 0.0));
+  store.add(makeState(1.5, 10.0, 0.0, true));
+  store.add(makeState(3.0, 30.0, 0.0, true));
+  EXPECT_EQ(store.size(), 4u);
+
+  TrajectoryStore::State s;
+  ASSERT_TRUE(store.lookup(ros::Time(1.5), s));
+  EXPECT_TRUE(s.optimized);
+  EXPECT_NEAR(s.pose.position.x, 10.0, 1e-9);
+  ASSERT_TRUE(store.lookup(ros::Time(1.75), s));
+  EXPECT_FALSE(s.optimized);
+  EXPECT_NEAR(s.pose.position.x, 6.0, 1e-9);
+  ASSERT_TRUE(store.lookup(ros::Time(3.0), s));
+  EXPECT_NEAR(s.pose.position.x, 30.0, 1e-9);
+}
+
+/**
+  * @test States older than maxAge behind the newest are dropped
+  */
+TEST(TrajectoryStore, maxAge)
+{
+  TrajectoryStore store(ros::Duration(1.0));
+  for(int i = 0; i <= 100; ++i)
+  {
+    store.add(makeState(100.0 + 0.05*i, i, 0.0));
+  }
+  EXPECT_EQ(store.size(), 21u);
+  EXPECT_NEAR(store.oldest().toSec(), 104.0, 1e-6);
+  EXPECT_NEAR(store.newest().toSec(), 105.0, 1e-6);
+}
+
+/**
+  * @test Stores are shared by name
+  */
+TEST(TrajectoryStore, registry)
+{
+  EXPECT_EQ(TrajectoryStore::get("/pose_estimate"), TrajectoryStore::get("/pose_estimate"));
+  EXPECT_NE(TrajectoryStore::get("/pose_estimate"), TrajectoryStore::get("/other"));
+}